@@ -21,6 +21,7 @@ print_usage() {
     echo "                             at build time, then enables and configures AosCore"
     echo "  test                       runs tests only"
     echo "  coverage                   runs tests with coverage"
+    echo "  benchmark                  runs benchmarks and stores JSON results to build/benchmarks"
     echo "  lint                       runs static analysis (cppcheck)"
     echo "  doc                        generates documentation"
     echo
@@ -36,6 +37,7 @@ print_usage() {
     echo "  --no-test                  builds without tests (tests are built by default)"
     echo "  --no-coverage              builds without coverage instrumentation (coverage is built by default)"
     echo "  --aos-install              installs AosCore configs, systemd services and dependencies (disabled by default)"
+    echo "  --benchmark                builds benchmarks (disabled by default)"
     echo
 }
 
@@ -152,6 +154,7 @@ cmake_configure() {
         -DWITH_VCHAN=OFF \
         -DWITH_COVERAGE="$ARG_WITH_COVERAGE" \
         -DWITH_TEST="$ARG_WITH_TEST" \
+        -DWITH_BENCHMARK="$ARG_WITH_BENCHMARK" \
         -DWITH_AOS_INSTALL="$ARG_WITH_AOS_INSTALL" \
         -DWITH_CM="$with_cm" \
         -DWITH_IAM="$with_iam" \
@@ -256,6 +259,11 @@ parse_arguments() {
             shift
             ;;
 
+        --benchmark)
+            ARG_WITH_BENCHMARK=ON
+            shift
+            ;;
+
         *)
             error_with_usage "Unknown option: $1"
             ;;
@@ -389,6 +397,15 @@ run_coverage() {
     echo "Coverage completed!"
 }
 
+run_benchmarks() {
+    print_next_step "Run benchmarks"
+
+    cd ./build
+    make benchmark
+    echo
+    echo "Benchmarks completed!"
+}
+
 run_lint() {
     cmake_configure
 
@@ -431,6 +448,7 @@ ARG_BUILD_TYPE="Debug"
 ARG_WITH_TEST=ON
 ARG_WITH_COVERAGE=ON
 ARG_WITH_AOS_INSTALL=OFF
+ARG_WITH_BENCHMARK=OFF
 
 case "$command" in
 build)
@@ -450,6 +468,10 @@ coverage)
     run_coverage
     ;;
 
+benchmark)
+    run_benchmarks
+    ;;
+
 lint)
     run_lint
     ;;
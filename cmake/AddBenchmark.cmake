@@ -0,0 +1,63 @@
+#
+# Copyright (C) 2025 EPAM Systems, Inc.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+
+# ######################################################################################################################
+# add_benchmark
+#
+# Adds Google Benchmark executable. Arguments follow add_test: TARGET_NAME, LOG_MODULE, SOURCES, COMPILE_OPTIONS and
+# LIBRARIES. The target name is prefixed with TARGET_PREFIX.
+# ######################################################################################################################
+
+function(add_benchmark)
+    cmake_parse_arguments(ARG "LOG_MODULE" "TARGET_NAME" "SOURCES;COMPILE_OPTIONS;LIBRARIES" ${ARGN})
+
+    set(target ${TARGET_PREFIX}_${ARG_TARGET_NAME})
+
+    add_executable(${target} ${ARG_SOURCES})
+
+    if(ARG_LOG_MODULE)
+        target_compile_definitions(${target} PRIVATE LOG_MODULE="${ARG_TARGET_NAME}")
+    endif()
+
+    target_compile_options(${target} PRIVATE ${ARG_COMPILE_OPTIONS})
+    target_link_libraries(${target} PRIVATE ${ARG_LIBRARIES} benchmark::benchmark_main)
+
+    set_property(GLOBAL APPEND PROPERTY AOS_BENCHMARKS ${target})
+endfunction()
+
+# ######################################################################################################################
+# add_benchmark_target
+#
+# Adds benchmark target which runs all added benchmarks and stores results in JSON format to
+# ${CMAKE_BINARY_DIR}/benchmarks/<target>.json for CI regression tracking.
+# ######################################################################################################################
+
+function(add_benchmark_target)
+    get_property(benchmarks GLOBAL PROPERTY AOS_BENCHMARKS)
+
+    set(outputDir ${CMAKE_BINARY_DIR}/benchmarks)
+    set(commands COMMAND ${CMAKE_COMMAND} -E make_directory ${outputDir})
+
+    foreach(benchmark ${benchmarks})
+        list(
+            APPEND
+            commands
+            COMMAND
+            $<TARGET_FILE:${benchmark}>
+            --benchmark_out=${outputDir}/${benchmark}.json
+            --benchmark_out_format=json
+        )
+    endforeach()
+
+    add_custom_target(
+        benchmark
+        ${commands}
+        DEPENDS ${benchmarks}
+        WORKING_DIRECTORY ${CMAKE_BINARY_DIR}
+        COMMENT "Running benchmarks"
+        VERBATIM
+    )
+endfunction()
@@ -8,6 +8,7 @@ class AosCoreCpp(ConanFile):
     generators = "CMakeToolchain", "CMakeDeps"
 
     def requirements(self):
+        self.requires("benchmark/1.8.3")
         self.requires("grpc/1.54.3")
         self.requires("gtest/1.14.0")
         self.requires("libcurl/8.8.0")
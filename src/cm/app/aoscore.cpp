@@ -5,6 +5,7 @@
  */
 
 #include <common/utils/exception.hpp>
+#include <common/utils/startuporchestrator.hpp>
 #include <common/version/version.hpp>
 
 #include <cm/utils/uidgidvalidator.hpp>
@@ -31,209 +32,217 @@ void AosCore::Init(const std::string& configFile)
     err = config::ParseConfig(configFile.empty() ? cDefaultConfigFile : configFile, mConfig);
     AOS_ERROR_CHECK_AND_THROW(err, "can't parse config");
 
-    // Initialize crypto provider
-
-    err = mCryptoProvider.Init(mAllocator);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize crypto provider");
-
-    // Initialize PKCS11 manager
-
-    err = mPKCS11Manager.Init(mAllocator);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize PKCS11 manager");
-
-    // Initialize cert loader
-
-    err = mCertLoader.Init(mAllocator, mCryptoProvider, mPKCS11Manager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize cert loader");
-
-    // Initialize crypto helper
-
-    err = mCryptoHelper.Init(mAllocator, mIAMClient, mCryptoProvider, mCertLoader, mConfig.mServiceDiscoveryURL.c_str(),
-        mConfig.mCACert.c_str());
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize crypto helper");
-
-    // Initialize file info provider
-
-    err = mFileInfoProvider.Init(mAllocator, mCryptoProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize file info provider");
-
-    // Initialize TLS credentials
-
-    err = mTLSCredentials.Init(mConfig.mCACert, mIAMClient, mCertLoader, mCryptoProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize TLS credentials");
-
-    // Initialize IAM client
-
-    err = mIAMClient.Init(mConfig.mIAMProtectedServerURL, mConfig.mIAMPublicServerURL, mConfig.mCertStorage,
-        mTLSCredentials, mConfig.mCertStorage.c_str(), false);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize IAM client");
-
-    // Initialize communication
-
-    err = mCommunication.Init(mConfig, mIAMClient, mIAMClient, mIAMClient, mCertLoader, mCryptoProvider, mCryptoHelper,
-        mCryptoProvider, mUpdateManager, mStorageState, mSMController, mLauncher, mIAMClient, mIAMClient);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize communication");
-
-    InitDatabase();
-    InitStorageState();
-
-    err = mAlerts.Init(mAllocator, mConfig.mAlerts, mCommunication, mCommunication);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize alerts");
-
-    err = mDownloadSpaceAllocator.Init(mAllocator, mConfig.mImageManager.mInstallPath, mPlatformFS, 0, &mImageManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize download space allocator");
-
-    err = mInstallSpaceAllocator.Init(mAllocator, mConfig.mImageManager.mInstallPath, mPlatformFS, 0, &mImageManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize install space allocator");
-
-    err = mDownloader.Init(&mAlerts);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize downloader");
-
-    err = mFileServer.Init(mConfig.mFileServerURL, mConfig.mImageManager.mInstallPath.CStr());
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize file server");
-
-    err = mImageManager.Init(mAllocator, mConfig.mImageManager, mDatabase, mCommunication, mDownloadSpaceAllocator,
-        mInstallSpaceAllocator, mDownloader, mFileServer, mCryptoHelper, mFileInfoProvider, mOCISpec);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize image manager");
-
-    err = mNodeInfoProvider.Init(mAllocator, mConfig.mNodeInfoProvider, mIAMClient);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize node info provider");
-
-    err = mMonitoring.Init(mConfig.mMonitoring, mCommunication, mCommunication, mLauncher, mNodeInfoProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize monitoring");
-
-    err = mUnitConfig.Init(
-        mAllocator, {mConfig.mUnitConfigFile.c_str()}, mNodeInfoProvider, mSMController, mJSONProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize unit config");
-
-    err = mLauncher.Init(mAllocator, mConfig.mLauncher, mNodeInfoProvider, mSMController, mImageManager, mOCISpec,
-        mUnitConfig, mStorageState, mSMController, mAlerts, mIAMClient, utils::IsUIDValid, utils::IsGIDValid, mDatabase,
-        mCommunication);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize launcher");
-
-    err = mUpdateManager.Init(mAllocator, {mConfig.mUnitStatusSendTimeout}, mIAMClient, mIAMClient, mUnitConfig,
-        mNodeInfoProvider, mImageManager, mLauncher, mCommunication, mCommunication, mDatabase);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize update manager");
-
-    mDNSServer.Init(mConfig.mDNSStoragePath, mConfig.mDNSPidFile, mConfig.mDNSIP);
-
-    err = mNetworkManager.Init(mDatabase, mCryptoProvider, mDNSServer, &mSMController);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize network manager");
-
-    InitSMController();
-}
-
-void AosCore::Start()
-{
-    LOG_INF() << "Start CM";
-
-    auto err = mFSWatcher.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start FS watcher");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mFSWatcher.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop FS watcher" << Log::Field(err);
-        }
-    });
-
-    err = mFileServer.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start file server");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mFileServer.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop file server" << Log::Field(err);
-        }
-    });
-
-    err = mStorageState.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start storage state");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mStorageState.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop storage state" << Log::Field(err);
-        }
-    });
-
-    err = mAlerts.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start alerts");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mAlerts.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop alerts" << Log::Field(err);
-        }
-    });
-
-    err = mUnitConfig.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start unit config");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mUnitConfig.Stop(); !err.IsNone()) {
-            LOG_ERR() << "can't stop unit config" << Log::Field(err);
-        }
+    // Modules are initialized concurrently, each step depends on the modules it uses during initialization.
+
+    common::utils::StartupOrchestrator orchestrator("CM init");
+
+    auto addStep = [&orchestrator](const std::string& name, common::utils::StartupOrchestrator::Step step,
+                       const std::vector<std::string>& dependencies = {}) {
+        auto err = orchestrator.AddStep(name, std::move(step), dependencies);
+        AOS_ERROR_CHECK_AND_THROW(err, "can't add init step");
+    };
+
+    // Allocator is thread safe, only crypto library and PKCS11 initialization is not reentrant: crypto provider,
+    // PKCS11 manager and cert loader are chained, other steps depend only on the modules they use.
+    addStep("crypto provider", [this]() { return mCryptoProvider.Init(mAllocator); });
+    addStep(
+        "PKCS11 manager", [this]() { return mPKCS11Manager.Init(mAllocator); }, {"crypto provider"});
+    addStep(
+        "cert loader", [this]() { return mCertLoader.Init(mAllocator, mCryptoProvider, mPKCS11Manager); },
+        {"crypto provider", "PKCS11 manager"});
+    addStep(
+        "crypto helper",
+        [this]() {
+            return mCryptoHelper.Init(mAllocator, mIAMClient, mCryptoProvider, mCertLoader,
+                mConfig.mServiceDiscoveryURL.c_str(), mConfig.mCACert.c_str());
+        },
+        {"cert loader"});
+    addStep(
+        "file info provider", [this]() { return mFileInfoProvider.Init(mAllocator, mCryptoProvider); },
+        {"crypto provider"});
+    addStep(
+        "TLS credentials",
+        [this]() { return mTLSCredentials.Init(mConfig.mCACert, mIAMClient, mCertLoader, mCryptoProvider); },
+        {"cert loader"});
+    addStep(
+        "IAM client",
+        [this]() {
+            return mIAMClient.Init(mConfig.mIAMProtectedServerURL, mConfig.mIAMPublicServerURL, mConfig.mCertStorage,
+                mTLSCredentials, mConfig.mCertStorage.c_str(), false);
+        },
+        {"TLS credentials"});
+    addStep(
+        "communication",
+        [this]() {
+            return mCommunication.Init(mConfig, mIAMClient, mIAMClient, mIAMClient, mCertLoader, mCryptoProvider,
+                mCryptoHelper, mCryptoProvider, mUpdateManager, mStorageState, mSMController, mLauncher, mIAMClient,
+                mIAMClient);
+        },
+        {"IAM client", "crypto helper"});
+    addStep("database", [this]() {
+        InitDatabase();
+
+        return ErrorEnum::eNone;
     });
-
-    err = mNodeInfoProvider.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start node info provider");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mNodeInfoProvider.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop node info provider" << Log::Field(err);
-        }
+    addStep(
+        "storage state",
+        [this]() {
+            InitStorageState();
+
+            return ErrorEnum::eNone;
+        },
+        {"database", "communication"});
+    addStep(
+        "alerts", [this]() { return mAlerts.Init(mAllocator, mConfig.mAlerts, mCommunication, mCommunication); },
+        {"communication"});
+    addStep("download space allocator", [this]() {
+        return mDownloadSpaceAllocator.Init(
+            mAllocator, mConfig.mImageManager.mInstallPath, mPlatformFS, 0, &mImageManager);
     });
-
-    err = mMonitoring.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start monitoring");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mMonitoring.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop monitoring" << Log::Field(err);
-        }
+    addStep("install space allocator", [this]() {
+        return mInstallSpaceAllocator.Init(
+            mAllocator, mConfig.mImageManager.mInstallPath, mPlatformFS, 0, &mImageManager);
     });
-
-    err = mImageManager.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start image manager");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mImageManager.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop image manager" << Log::Field(err);
-        }
+    addStep(
+        "downloader", [this]() { return mDownloader.Init(&mAlerts); }, {"alerts"});
+    addStep("file server", [this]() {
+        return mFileServer.Init(mConfig.mFileServerURL, mConfig.mImageManager.mInstallPath.CStr());
     });
-
-    err = mLauncher.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start launcher");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mLauncher.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop launcher" << Log::Field(err);
-        }
+    addStep(
+        "image manager",
+        [this]() {
+            return mImageManager.Init(mAllocator, mConfig.mImageManager, mDatabase, mCommunication,
+                mDownloadSpaceAllocator, mInstallSpaceAllocator, mDownloader, mFileServer, mCryptoHelper,
+                mFileInfoProvider, mOCISpec);
+        },
+        {"database", "communication", "download space allocator", "install space allocator", "downloader",
+            "file server", "crypto helper", "file info provider"});
+    addStep(
+        "node info provider",
+        [this]() { return mNodeInfoProvider.Init(mAllocator, mConfig.mNodeInfoProvider, mIAMClient); },
+        {"IAM client"});
+    addStep(
+        "monitoring",
+        [this]() {
+            return mMonitoring.Init(mConfig.mMonitoring, mCommunication, mCommunication, mLauncher, mNodeInfoProvider);
+        },
+        {"communication", "node info provider"});
+    addStep(
+        "unit config",
+        [this]() {
+            return mUnitConfig.Init(
+                mAllocator, {mConfig.mUnitConfigFile.c_str()}, mNodeInfoProvider, mSMController, mJSONProvider);
+        },
+        {"node info provider"});
+    addStep(
+        "launcher",
+        [this]() {
+            return mLauncher.Init(mAllocator, mConfig.mLauncher, mNodeInfoProvider, mSMController, mImageManager,
+                mOCISpec, mUnitConfig, mStorageState, mSMController, mAlerts, mIAMClient, utils::IsUIDValid,
+                utils::IsGIDValid, mDatabase, mCommunication);
+        },
+        {"node info provider", "image manager", "unit config", "storage state", "alerts", "IAM client", "database",
+            "communication"});
+    addStep(
+        "update manager",
+        [this]() {
+            return mUpdateManager.Init(mAllocator, {mConfig.mUnitStatusSendTimeout}, mIAMClient, mIAMClient,
+                mUnitConfig, mNodeInfoProvider, mImageManager, mLauncher, mCommunication, mCommunication, mDatabase);
+        },
+        {"IAM client", "unit config", "node info provider", "image manager", "launcher", "communication",
+            "database"});
+    addStep("DNS server", [this]() {
+        mDNSServer.Init(mConfig.mDNSStoragePath, mConfig.mDNSPidFile, mConfig.mDNSIP);
+
+        return ErrorEnum::eNone;
     });
+    addStep(
+        "network manager",
+        [this]() { return mNetworkManager.Init(mDatabase, mCryptoProvider, mDNSServer, &mSMController); },
+        {"database", "crypto provider", "DNS server"});
+    addStep(
+        "SM controller",
+        [this]() {
+            InitSMController();
 
-    err = mSMController.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start SM controller");
+            return ErrorEnum::eNone;
+        },
+        {"communication", "IAM client", "cert loader", "image manager", "alerts", "monitoring", "launcher",
+            "node info provider", "network manager"});
 
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mSMController.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop SM controller" << Log::Field(err);
-        }
-    });
+    err = orchestrator.Run();
 
-    err = mUpdateManager.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start update manager");
+    orchestrator.LogTimings();
 
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mUpdateManager.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop update manager" << Log::Field(err);
-        }
-    });
+    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize CM");
+}
 
-    err = mCommunication.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start communication");
+void AosCore::Start()
+{
+    LOG_INF() << "Start CM";
 
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mCommunication.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop communication" << Log::Field(err);
-        }
-    });
+    common::utils::StartupOrchestrator orchestrator("CM start");
+
+    auto addStep = [this, &orchestrator](const std::string& name, std::function<Error()> start,
+                       std::function<Error()> stop, const std::vector<std::string>& dependencies = {}) {
+        auto step = [this, name, start = std::move(start), stop = std::move(stop)]() {
+            if (auto err = start(); !err.IsNone()) {
+                return err;
+            }
+
+            mCleanupManager.AddCleanup([name, stop]() {
+                if (auto err = stop(); !err.IsNone()) {
+                    LOG_ERR() << "Can't stop module" << Log::Field("name", name.c_str()) << Log::Field(err);
+                }
+            });
+
+            return Error(ErrorEnum::eNone);
+        };
+
+        auto err = orchestrator.AddStep(name, std::move(step), dependencies);
+        AOS_ERROR_CHECK_AND_THROW(err, "can't add start step");
+    };
+
+    addStep(
+        "FS watcher", [this]() { return mFSWatcher.Start(); }, [this]() { return mFSWatcher.Stop(); });
+    addStep(
+        "file server", [this]() { return mFileServer.Start(); }, [this]() { return mFileServer.Stop(); });
+    addStep(
+        "storage state", [this]() { return mStorageState.Start(); }, [this]() { return mStorageState.Stop(); },
+        {"FS watcher"});
+    addStep(
+        "alerts", [this]() { return mAlerts.Start(); }, [this]() { return mAlerts.Stop(); });
+    addStep(
+        "unit config", [this]() { return mUnitConfig.Start(); }, [this]() { return mUnitConfig.Stop(); });
+    addStep(
+        "node info provider", [this]() { return mNodeInfoProvider.Start(); },
+        [this]() { return mNodeInfoProvider.Stop(); });
+    addStep(
+        "monitoring", [this]() { return mMonitoring.Start(); }, [this]() { return mMonitoring.Stop(); },
+        {"node info provider"});
+    addStep(
+        "image manager", [this]() { return mImageManager.Start(); }, [this]() { return mImageManager.Stop(); },
+        {"file server"});
+    addStep(
+        "launcher", [this]() { return mLauncher.Start(); }, [this]() { return mLauncher.Stop(); },
+        {"storage state", "alerts", "unit config", "node info provider", "monitoring", "image manager"});
+
+    // External interfaces are started last, once all internal modules are running.
+    addStep(
+        "SM controller", [this]() { return mSMController.Start(); }, [this]() { return mSMController.Stop(); },
+        {"launcher"});
+    addStep(
+        "update manager", [this]() { return mUpdateManager.Start(); }, [this]() { return mUpdateManager.Stop(); },
+        {"SM controller"});
+    addStep(
+        "communication", [this]() { return mCommunication.Start(); }, [this]() { return mCommunication.Stop(); },
+        {"update manager"});
+
+    auto err = orchestrator.Run();
+
+    orchestrator.LogTimings();
+
+    AOS_ERROR_CHECK_AND_THROW(err, "can't start CM");
 }
 
 void AosCore::Stop()
@@ -289,9 +298,11 @@ void AosCore::InitSMController()
 {
     smcontroller::Config config;
 
-    config.mCACert      = mConfig.mCACert;
-    config.mCertStorage = mConfig.mCertStorage;
-    config.mCMServerURL = mConfig.mCMServerURL;
+    config.mCACert                  = mConfig.mCACert;
+    config.mCertStorage             = mConfig.mCertStorage;
+    config.mCMServerURL             = mConfig.mCMServerURL;
+    config.mMonitoringAverageWindow = mConfig.mMonitoring.mAverageWindow;
+    config.mMonitoringHistorySize   = mConfig.mMonitoring.mHistorySize;
 
     auto err = mSMController.Init(config, mCommunication, mIAMClient, mCertLoader, mCryptoProvider, mImageManager,
         mAlerts, mCommunication, mCommunication, mMonitoring, mLauncher, mNodeInfoProvider, mNetworkManager);
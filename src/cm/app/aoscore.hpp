@@ -86,6 +86,7 @@ private:
     void InitStorageState();
     void InitSMController();
 
+    // Shared by all modules, thread safe.
     aos::HeapAllocator mAllocator;
 
     config::Config mConfig = {};
@@ -16,6 +16,7 @@
 #include <core/common/version/version.hpp>
 
 #include <common/utils/exception.hpp>
+#include <common/utils/tracer.hpp>
 #include <common/version/version.hpp>
 
 #include "app.hpp"
@@ -121,11 +122,17 @@ void App::uninitialize()
 {
     Application::uninitialize();
 
-    if (!mInitialized) {
-        return;
+    if (mInitialized) {
+        mAosCore->Stop();
     }
 
-    mAosCore->Stop();
+    if (common::utils::Tracer::IsEnabled()) {
+        if (auto err = common::utils::Tracer::Get().Dump(); !err.IsNone()) {
+            LOG_ERR() << "Can't dump trace" << Log::Field(err);
+        }
+
+        common::utils::Tracer::Get().Disable();
+    }
 }
 
 void App::reinitialize(Application& self)
@@ -164,6 +171,9 @@ void App::defineOptions(Poco::Util::OptionSet& options)
                           .callback(Poco::Util::OptionCallback<App>(this, &App::HandleVersion)));
     options.addOption(Poco::Util::Option("journal", "j", "redirects logs to systemd journal")
                           .callback(Poco::Util::OptionCallback<App>(this, &App::HandleJournal)));
+    options.addOption(Poco::Util::Option("trace", "t", "enables tracing, trace is dumped on SIGUSR1 and on exit")
+                          .argument("${file}")
+                          .callback(Poco::Util::OptionCallback<App>(this, &App::HandleTrace)));
 }
 
 /***********************************************************************************************************************
@@ -194,6 +204,15 @@ void App::HandleConfigFile(const std::string& name, const std::string& value)
     mConfigFile = value;
 }
 
+void App::HandleTrace(const std::string& name, const std::string& value)
+{
+    (void)name;
+
+    if (auto err = common::utils::Tracer::Get().Enable(value); !err.IsNone()) {
+        throw Poco::Exception("can't enable tracing", value);
+    }
+}
+
 void App::HandleLogLevel(const std::string& name, const std::string& value)
 {
     (void)name;
@@ -36,6 +36,7 @@ private:
 
     void HandleHelp(const std::string& name, const std::string& value);
     void HandleConfigFile(const std::string& name, const std::string& value);
+    void HandleTrace(const std::string& name, const std::string& value);
     void HandleLogLevel(const std::string& name, const std::string& value);
     void HandleReset(const std::string& name, const std::string& value);
     void HandleVersion(const std::string& name, const std::string& value);
@@ -30,6 +30,7 @@
 #include <common/utils/json.hpp>
 #include <common/utils/pkcs11helper.hpp>
 #include <common/utils/retry.hpp>
+#include <common/utils/tracer.hpp>
 
 #include "communication.hpp"
 
@@ -894,7 +895,9 @@ void Communication::HandleSendQueue()
         }
 
         try {
-            const auto data = it->Payload();
+            AOS_TRACE_SPAN("cloud", "SendMessage");
+
+            const auto& data = it->Payload();
 
             WriteToMessageLog("TX", data);
 
@@ -903,7 +906,7 @@ void Communication::HandleSendQueue()
             LOG_DBG() << "Sent message" << Log::Field("sentBytes", sentBytes) << Log::Field("message", data.c_str());
 
             if (it->Pollicy() == SendPollicy::eExpectAck) {
-                mSentMessages.emplace(it->Txn(), *it);
+                mSentMessages.emplace(it->Txn(), std::move(*it));
             }
 
             mSendQueue.erase(it);
@@ -992,6 +995,8 @@ void Communication::HandleReceivedMessage()
 
 Error Communication::HandleMessage(const std::string& message)
 {
+    AOS_TRACE_FUNCTION("cloud");
+
     LOG_DBG() << "Handle cloud message" << Log::Field("message", message.c_str());
 
     auto parseResult = common::utils::ParseJson(message);
@@ -1073,7 +1078,7 @@ Error Communication::EnqueueMessage(
     return EnqueueMessage(Message(txn, std::move(payload)), onResponseReceived);
 }
 
-Error Communication::EnqueueMessage(const Message& msg, OnResponseReceivedFunc onResponseReceived)
+Error Communication::EnqueueMessage(Message msg, OnResponseReceivedFunc onResponseReceived)
 {
     std::unique_lock lock {mMutex};
 
@@ -1084,7 +1089,7 @@ Error Communication::EnqueueMessage(const Message& msg, OnResponseReceivedFunc o
         mResponseHandlers.emplace(msg.CorrelationID(), onResponseReceived);
     }
 
-    mSendQueue.push_back(msg);
+    mSendQueue.push_back(std::move(msg));
     mCondVar.notify_all();
 
     return ErrorEnum::eNone;
@@ -1134,7 +1139,7 @@ void Communication::HandleMessage(const ResponseInfo& info, const common::cloudp
         return;
     }
 
-    auto msg = it->second;
+    auto msg = std::move(it->second);
     msg.ResetTimestamp(Time::Now().Add(nack.mRetryAfter));
 
     mSendQueue.push_back(std::move(msg));
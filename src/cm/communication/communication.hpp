@@ -10,6 +10,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -209,7 +210,7 @@ private:
             SendPollicy sendPollicy = SendPollicy::eExpectAck, const std::string& correlationId = {},
             const Time& timestamp = Time::Now())
             : mTxn(txn)
-            , mPayload(std::move(payload))
+            , mPayload(std::make_shared<const std::string>(common::utils::Stringify(payload)))
             , mSendPollicy(sendPollicy)
             , mCorrelationID(correlationId)
             , mTimestamp(timestamp)
@@ -218,7 +219,7 @@ private:
 
         const std::string& Txn() const { return mTxn; }
         const std::string& CorrelationID() const { return mCorrelationID; }
-        std::string        Payload() const { return common::utils::Stringify(mPayload); }
+        const std::string& Payload() const { return *mPayload; }
         SendPollicy        Pollicy() const { return mSendPollicy; }
         const Time&        Timestamp() const { return mTimestamp; }
         void               ResetTimestamp(const Time& time) { mTimestamp = time; }
@@ -228,12 +229,14 @@ private:
     private:
         static constexpr auto cMaxTries = 3;
 
-        std::string             mTxn;
-        Poco::JSON::Object::Ptr mPayload;
-        SendPollicy             mSendPollicy {SendPollicy::eExpectAck};
-        std::string             mCorrelationID;
-        Time                    mTimestamp {Time::Now()};
-        size_t                  mTries {};
+        std::string                        mTxn;
+        // Payload is serialized once on creation and shared between copies: resending doesn't stringify or copy it
+        // again under the queue lock.
+        std::shared_ptr<const std::string> mPayload;
+        SendPollicy                        mSendPollicy {SendPollicy::eExpectAck};
+        std::string                        mCorrelationID;
+        Time                               mTimestamp {Time::Now()};
+        size_t                             mTries {};
     };
 
     struct ResponseInfo {
@@ -264,7 +267,7 @@ private:
     Error GenerateUUID(String& uuid) const;
     Error EnqueueMessage(
         Poco::JSON::Object::Ptr data, bool important = false, OnResponseReceivedFunc onResponseReceived = {});
-    Error EnqueueMessage(const Message& msg, OnResponseReceivedFunc onResponseReceived = {});
+    Error EnqueueMessage(Message msg, OnResponseReceivedFunc onResponseReceived = {});
     Error DequeueMessage(const Message& msg);
 
     void  HandleMessage(const ResponseInfo& info, const common::cloudprotocol::Ack& ack);
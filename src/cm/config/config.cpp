@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 
@@ -28,6 +29,7 @@ constexpr auto cDefaultLauncherInstanceTTL                = "30d";
 constexpr auto cDefaultLauncherCheckOverrideEnvVarsPeriod = "1m";
 constexpr auto cDefaultLauncherNodesConnectionTimeout     = "10m";
 constexpr auto cDefaultMonitoringSendPeriod               = "1m";
+constexpr auto cDefaultMonitoringHistorySize              = 64;
 constexpr auto cDefaultSMConnectionTimeout                = "1m";
 constexpr auto cDefaultUnitStatusSendTimeout              = "10s";
 constexpr auto cDefaultUpdateItemTTL                      = "30d";
@@ -51,6 +53,26 @@ void ParseMonitoringConfig(const common::utils::CaseInsensitiveObjectWrapper& ob
     Tie(config.mSendPeriod, err)
         = common::utils::ParseDuration(object.GetValue<std::string>("sendPeriod", cDefaultMonitoringSendPeriod));
     AOS_ERROR_CHECK_AND_THROW(err, "error parsing sendPeriod tag");
+
+    // Average monitoring is calculated by CM over averageWindow from samples received every pollPeriod, so the history
+    // should hold at least one window of samples.
+    const auto minHistorySize = config.mPollPeriod.Nanoseconds() > 0
+        ? static_cast<size_t>(config.mAverageWindow.Nanoseconds() / config.mPollPeriod.Nanoseconds()) + 1
+        : size_t {1};
+
+    const auto historySize = object.GetOptionalValue<size_t>("historySize");
+    if (!historySize.has_value()) {
+        config.mHistorySize = std::max<size_t>(cDefaultMonitoringHistorySize, minHistorySize);
+
+        return;
+    }
+
+    if (*historySize < minHistorySize) {
+        AOS_ERROR_THROW(ErrorEnum::eInvalidArgument,
+            "historySize should be at least " + std::to_string(minHistorySize) + " to cover averageWindow");
+    }
+
+    config.mHistorySize = *historySize;
 }
 
 void ParseNodeInfoProviderConfig(
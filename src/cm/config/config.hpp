@@ -29,8 +29,14 @@ namespace aos::cm::config {
 
 /*
  * Monitoring configuration.
+ *
+ * Average monitoring of nodes is calculated by CM over mAverageWindow from instant monitoring received from SM, SM
+ * averaging settings are not used. mHistorySize is the number of samples kept per node: it is derived from
+ * mAverageWindow / mPollPeriod if not set and rejected if it can't hold a whole window.
  */
-struct Monitoring : public aos::monitoring::Config, public aos::cm::monitoring::Config { };
+struct Monitoring : public aos::monitoring::Config, public aos::cm::monitoring::Config {
+    size_t mHistorySize {};
+};
 
 /*
  * Config structure.
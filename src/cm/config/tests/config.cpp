@@ -37,7 +37,8 @@ constexpr auto cFullTestConfigJSON = R"({
     "unitConfigFile": "/var/aos/aos_unit.cfg",
     "cloudResponseWaitTimeout": "3d",
     "monitoring": {
-        "sendPeriod": "5m"
+        "sendPeriod": "5m",
+        "historySize": 128
     },
     "nodeinfoprovider": {
         "smConnectionTimeout": "10m"
@@ -131,6 +132,7 @@ TEST_F(CMConfigTest, ParseFullConfig)
     EXPECT_EQ(config.mCloudResponseWaitTimeout, aos::Time::cDay * 3);
 
     EXPECT_EQ(config.mMonitoring.mSendPeriod, aos::Time::cMinutes * 5);
+    EXPECT_EQ(config.mMonitoring.mHistorySize, 128);
     EXPECT_EQ(config.mNodeInfoProvider.mSMConnectionTimeout, aos::Time::cMinutes * 10);
     EXPECT_EQ(config.mAlerts.mSendPeriod, aos::Time::cMinutes * 13);
 
@@ -176,6 +178,7 @@ TEST_F(CMConfigTest, ParseMinimalConfigWithDefaults)
     EXPECT_EQ(config.mCloudResponseWaitTimeout, aos::Time::cSeconds * 10);
 
     EXPECT_EQ(config.mMonitoring.mSendPeriod, aos::Time::cMinutes * 1);
+    EXPECT_EQ(config.mMonitoring.mHistorySize, 64);
     EXPECT_EQ(config.mNodeInfoProvider.mSMConnectionTimeout, aos::Time::cMinutes * 1);
     EXPECT_EQ(config.mAlerts.mSendPeriod, aos::Time::cSeconds * 10);
 
@@ -188,3 +191,44 @@ TEST_F(CMConfigTest, ParseMinimalConfigWithDefaults)
 
     EXPECT_EQ(config.mDNSStoragePath, "/var/aos/dns");
 }
+
+TEST_F(CMConfigTest, HistorySizeCoversAverageWindow)
+{
+    constexpr auto cConfigJSON = R"({
+        "workingDir" : "workingDir",
+        "monitoring": {
+            "pollPeriod": "1s",
+            "averageWindow": "100s"
+        }
+    })";
+
+    if (std::ofstream file(cConfigFileName); file.good()) {
+        file << cConfigJSON;
+    }
+
+    aos::cm::config::Config config;
+
+    ASSERT_EQ(aos::cm::config::ParseConfig(cConfigFileName, config), aos::ErrorEnum::eNone);
+
+    EXPECT_EQ(config.mMonitoring.mHistorySize, 101);
+}
+
+TEST_F(CMConfigTest, HistorySizeTooSmallForAverageWindow)
+{
+    constexpr auto cConfigJSON = R"({
+        "workingDir" : "workingDir",
+        "monitoring": {
+            "pollPeriod": "1s",
+            "averageWindow": "100s",
+            "historySize": 10
+        }
+    })";
+
+    if (std::ofstream file(cConfigFileName); file.good()) {
+        file << cConfigJSON;
+    }
+
+    aos::cm::config::Config config;
+
+    EXPECT_TRUE(aos::cm::config::ParseConfig(cConfigFileName, config).Is(aos::ErrorEnum::eInvalidArgument));
+}
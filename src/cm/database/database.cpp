@@ -19,6 +19,7 @@
 #include <common/cloudprotocol/desiredstatus.hpp>
 #include <common/utils/exception.hpp>
 #include <common/utils/json.hpp>
+#include <common/utils/tracer.hpp>
 
 #include "database.hpp"
 
@@ -272,6 +273,8 @@ Error Database::Init(const Config& config)
 
 Error Database::AddStorageStateInfo(const storagestate::InstanceInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -290,6 +293,8 @@ Error Database::AddStorageStateInfo(const storagestate::InstanceInfo& info)
 
 Error Database::RemoveStorageStateInfo(const InstanceIdent& instanceIdent)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -312,6 +317,8 @@ Error Database::RemoveStorageStateInfo(const InstanceIdent& instanceIdent)
 
 Error Database::GetAllStorageStateInfo(Array<storagestate::InstanceInfo>& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -337,6 +344,8 @@ Error Database::GetAllStorageStateInfo(Array<storagestate::InstanceInfo>& info)
 
 Error Database::GetStorageStateInfo(const InstanceIdent& instanceIdent, storagestate::InstanceInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -363,6 +372,8 @@ Error Database::GetStorageStateInfo(const InstanceIdent& instanceIdent, storages
 
 Error Database::UpdateStorageStateInfo(const storagestate::InstanceInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -392,6 +403,8 @@ Error Database::UpdateStorageStateInfo(const storagestate::InstanceInfo& info)
 
 Error Database::AddNetwork(const networkmanager::Network& network)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -408,6 +421,8 @@ Error Database::AddNetwork(const networkmanager::Network& network)
 
 Error Database::AddHost(const String& networkID, const networkmanager::Host& host)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -424,6 +439,8 @@ Error Database::AddHost(const String& networkID, const networkmanager::Host& hos
 
 Error Database::AddInstance(const networkmanager::Instance& instance)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -442,6 +459,8 @@ Error Database::AddInstance(const networkmanager::Instance& instance)
 
 Error Database::GetNetworks(Array<networkmanager::Network>& networks)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -467,6 +486,8 @@ Error Database::GetNetworks(Array<networkmanager::Network>& networks)
 
 Error Database::GetHosts(const String& networkID, Array<networkmanager::Host>& hosts)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -493,6 +514,8 @@ Error Database::GetHosts(const String& networkID, Array<networkmanager::Host>& h
 
 Error Database::GetInstances(const String& networkID, const String& nodeID, Array<networkmanager::Instance>& instances)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -520,6 +543,8 @@ Error Database::GetInstances(const String& networkID, const String& nodeID, Arra
 
 Error Database::RemoveNetwork(const String& networkID)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -539,6 +564,8 @@ Error Database::RemoveNetwork(const String& networkID)
 
 Error Database::RemoveHost(const String& networkID, const String& nodeID)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -559,6 +586,8 @@ Error Database::RemoveHost(const String& networkID, const String& nodeID)
 
 Error Database::RemoveNetworkInstance(const InstanceIdent& instanceIdent)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -581,6 +610,8 @@ Error Database::RemoveNetworkInstance(const InstanceIdent& instanceIdent)
 
 Error Database::AddPendingConnection(const networkmanager::PendingConnection& connection)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -601,6 +632,8 @@ Error Database::AddPendingConnection(const networkmanager::PendingConnection& co
 Error Database::GetPendingConnectionsByTarget(
     const String& targetItemID, Array<networkmanager::PendingConnection>& connections)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -630,6 +663,8 @@ Error Database::GetPendingConnectionsByTarget(
 
 Error Database::GetAllPendingConnections(Array<networkmanager::PendingConnection>& connections)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -659,6 +694,8 @@ Error Database::GetAllPendingConnections(Array<networkmanager::PendingConnection
 
 Error Database::RemovePendingConnection(const networkmanager::PendingConnection& connection)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -679,6 +716,8 @@ Error Database::RemovePendingConnection(const networkmanager::PendingConnection&
 
 Error Database::RemovePendingConnections(const InstanceIdent& requesterIdent)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -700,6 +739,8 @@ Error Database::RemovePendingConnections(const InstanceIdent& requesterIdent)
 
 Error Database::AddInstance(const launcher::InstanceInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -720,6 +761,8 @@ Error Database::AddInstance(const launcher::InstanceInfo& info)
 
 Error Database::UpdateInstance(const launcher::InstanceInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -752,6 +795,8 @@ Error Database::UpdateInstance(const launcher::InstanceInfo& info)
 
 Error Database::LoadActiveInstances(Array<launcher::InstanceInfo>& instances) const
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -780,6 +825,8 @@ Error Database::LoadActiveInstances(Array<launcher::InstanceInfo>& instances) co
 
 Error Database::RemoveInstance(const InstanceIdent& instanceIdent, const String& version)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -804,6 +851,8 @@ Error Database::RemoveInstance(const InstanceIdent& instanceIdent, const String&
 
 Error Database::SaveOverrideEnvVars(const OverrideEnvVarsRequest& envVars)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -828,6 +877,8 @@ Error Database::SaveOverrideEnvVars(const OverrideEnvVarsRequest& envVars)
 
 Error Database::LoadOverrideEnvVars(OverrideEnvVarsRequest& envVars) const
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -854,6 +905,8 @@ Error Database::LoadOverrideEnvVars(OverrideEnvVarsRequest& envVars) const
 
 Error Database::LoadRunRequests(Array<launcher::RunInstanceRequest>& requests) const
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -880,6 +933,8 @@ Error Database::LoadRunRequests(Array<launcher::RunInstanceRequest>& requests) c
 
 Error Database::SaveRunRequests(const Array<launcher::RunInstanceRequest>& requests)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -909,6 +964,8 @@ Error Database::SaveRunRequests(const Array<launcher::RunInstanceRequest>& reque
 
 Error Database::AddItem(const imagemanager::ItemInfo& item)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -927,6 +984,8 @@ Error Database::AddItem(const imagemanager::ItemInfo& item)
 
 Error Database::RemoveItem(const String& id, const String& version)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -947,6 +1006,8 @@ Error Database::RemoveItem(const String& id, const String& version)
 
 Error Database::UpdateItemState(const String& id, const String& version, ItemState state, Time timestamp)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -967,6 +1028,8 @@ Error Database::UpdateItemState(const String& id, const String& version, ItemSta
 
 Error Database::GetAllItemsInfos(Array<imagemanager::ItemInfo>& items)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -992,6 +1055,8 @@ Error Database::GetAllItemsInfos(Array<imagemanager::ItemInfo>& items)
 
 Error Database::GetItemInfos(const String& id, Array<imagemanager::ItemInfo>& items)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -1018,6 +1083,8 @@ Error Database::GetItemInfos(const String& id, Array<imagemanager::ItemInfo>& it
 
 Error Database::StoreDesiredStatus(const DesiredStatus& desiredStatus)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -1037,6 +1104,8 @@ Error Database::StoreDesiredStatus(const DesiredStatus& desiredStatus)
 
 Error Database::StoreUpdateState(const updatemanager::UpdateState& state)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -1056,6 +1125,8 @@ Error Database::StoreUpdateState(const updatemanager::UpdateState& state)
 
 Error Database::GetDesiredStatus(DesiredStatus& desiredStatus)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
@@ -1078,6 +1149,8 @@ Error Database::GetDesiredStatus(DesiredStatus& desiredStatus)
 
 RetWithError<updatemanager::UpdateState> Database::GetUpdateState()
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
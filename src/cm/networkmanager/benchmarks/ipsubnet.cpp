@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <cm/networkmanager/ipsubnet.hpp>
+
+namespace aos::cm::networkmanager {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cNetworkID = "network";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+std::vector<std::string> CreateSubnetIPs(const std::string& subnet, size_t numIPs)
+{
+    auto [firstIP, count] = GetSubnetIPRange(subnet);
+
+    std::vector<std::string> ips;
+
+    for (uint32_t i = 0; i < std::min<uint32_t>(count, numIPs); i++) {
+        ips.push_back(UINT32ToIP(firstIP + i));
+    }
+
+    return ips;
+}
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+// Allocates and releases IP in a /16 network which already has the given number of IPs in use.
+void BM_GetAvailableIP(benchmark::State& state)
+{
+    IpSubnet ipSubnet;
+
+    ipSubnet.Init();
+
+    const auto subnet = GetNetPools().front();
+
+    ipSubnet.RemoveAllocatedSubnet(cNetworkID, subnet, CreateSubnetIPs(subnet, state.range(0)));
+
+    for (auto _ : state) {
+        auto ip = ipSubnet.GetAvailableIP(cNetworkID);
+
+        ipSubnet.ReleaseIPToSubnet(cNetworkID, ip);
+    }
+}
+
+BENCHMARK(BM_GetAvailableIP)->Arg(0)->Arg(1024)->Arg(60000);
+
+// Restores all predefined /16 networks with the given number of IPs in use each, as done on CM start.
+void BM_RestoreNetworks(benchmark::State& state)
+{
+    const auto pools = GetNetPools();
+
+    std::vector<std::vector<std::string>> ips;
+
+    for (const auto& subnet : pools) {
+        ips.push_back(CreateSubnetIPs(subnet, state.range(0)));
+    }
+
+    for (auto _ : state) {
+        IpSubnet ipSubnet;
+
+        ipSubnet.Init();
+
+        for (size_t i = 0; i < pools.size(); i++) {
+            ipSubnet.RemoveAllocatedSubnet(cNetworkID + std::to_string(i), pools[i], ips[i]);
+        }
+
+        benchmark::DoNotOptimize(ipSubnet);
+    }
+
+    state.counters["networks"] = static_cast<double>(pools.size());
+    state.SetItemsProcessed(state.iterations() * pools.size() * state.range(0));
+}
+
+BENCHMARK(BM_RestoreNetworks)->Arg(0)->Arg(1024);
+
+} // namespace
+
+} // namespace aos::cm::networkmanager
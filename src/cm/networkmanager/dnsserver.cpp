@@ -16,7 +16,10 @@
 #include <Poco/Process.h>
 #include <Poco/String.h>
 
+#include <core/common/tools/logger.hpp>
+
 #include <common/utils/exception.hpp>
+#include <common/utils/filesystem.hpp>
 
 #include "dnsserver.hpp"
 
@@ -26,36 +29,47 @@ namespace aos::cm::networkmanager {
  * Public
  **********************************************************************************************************************/
 
-void DNSServer::Init(const std::string& dnsStoragePath, const std::string& dnsPidFile, const std::string& dnsIP)
+DNSServer::~DNSServer()
 {
+    if (auto err = mReloadTimer.Stop(Timer::StopMode::WaitForCallbacks);
+        !err.IsNone() && !err.Is(ErrorEnum::eWrongState)) {
+        LOG_ERR() << "Failed to stop DNS reload timer" << Log::Field(err);
+    }
+
+    std::lock_guard lock {mMutex};
+
+    if (!mReloadPending) {
+        return;
+    }
+
+    mReloadPending = false;
+
+    if (auto err = Flush(); !err.IsNone()) {
+        LOG_ERR() << "Failed to apply pending DNS hosts" << Log::Field(err);
+    }
+}
+
+void DNSServer::Init(
+    const std::string& dnsStoragePath, const std::string& dnsPidFile, const std::string& dnsIP, Duration reloadDelay)
+{
+    std::lock_guard lock {mMutex};
+
     mDNSStoragePath = dnsStoragePath;
     mDNSPidFile     = dnsPidFile;
     mIP             = dnsIP;
+    mReloadDelay    = reloadDelay;
 }
 
 Error DNSServer::UpdateHostsFile(const HostsMap& hosts)
 {
-    auto hostsFilePath = mDNSStoragePath + "/" + cHostFileName;
+    std::lock_guard lock {mMutex};
 
-    std::ofstream file(hostsFilePath, std::ios::out | std::ios::trunc);
-    if (!file.is_open()) {
-        return Error(ErrorEnum::eRuntime, "failed to open hosts file");
+    if (mHostsApplied && hosts == mHosts) {
+        return ErrorEnum::eNone;
     }
 
-    for (const auto& [ip, hostNames] : hosts) {
-        std::string entry = ip;
-
-        for (const auto& hostName : hostNames) {
-            entry += "\t" + hostName;
-        }
-
-        entry += "\n";
-
-        file << entry;
-        if (file.fail()) {
-            return Error(ErrorEnum::eRuntime, "failed to write to hosts file");
-        }
-    }
+    mHosts        = hosts;
+    mHostsApplied = false;
 
     return ErrorEnum::eNone;
 }
@@ -67,12 +81,24 @@ std::string DNSServer::GetIP() const
 
 Error DNSServer::Restart()
 {
-    try {
-        RestartProcess(FindServerProcess());
-    } catch (const std::runtime_error& e) {
-        return common::utils::ToAosError(e);
+    std::lock_guard lock {mMutex};
+
+    if (mHostsApplied || mReloadPending) {
+        return ErrorEnum::eNone;
     }
 
+    if (mReloadDelay == 0) {
+        return Flush();
+    }
+
+    if (auto err = mReloadTimer.Start(mReloadDelay, [this](void*) { OnReloadTimer(); }); !err.IsNone()) {
+        LOG_WRN() << "Can't schedule DNS reload, reload now" << Log::Field(err);
+
+        return Flush();
+    }
+
+    mReloadPending = true;
+
     return ErrorEnum::eNone;
 }
 
@@ -118,4 +144,58 @@ void DNSServer::RestartProcess(Poco::Process::PID pid)
     }
 }
 
+Error DNSServer::WriteHostsFile()
+{
+    std::string content;
+
+    for (const auto& [ip, hostNames] : mHosts) {
+        content += ip;
+
+        for (const auto& hostName : hostNames) {
+            content += "\t" + hostName;
+        }
+
+        content += "\n";
+    }
+
+    // DNS server may reread the hosts file at any time, so replace it atomically.
+    if (auto err = common::utils::WriteFileAtomically(mDNSStoragePath + "/" + cHostFileName, content); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error DNSServer::Flush()
+{
+    if (auto err = WriteHostsFile(); !err.IsNone()) {
+        return err;
+    }
+
+    try {
+        RestartProcess(FindServerProcess());
+    } catch (const std::runtime_error& e) {
+        return common::utils::ToAosError(e);
+    }
+
+    mHostsApplied = true;
+
+    return ErrorEnum::eNone;
+}
+
+void DNSServer::OnReloadTimer()
+{
+    std::lock_guard lock {mMutex};
+
+    if (!mReloadPending) {
+        return;
+    }
+
+    mReloadPending = false;
+
+    if (auto err = Flush(); !err.IsNone()) {
+        LOG_ERR() << "Failed to reload DNS hosts" << Log::Field(err);
+    }
+}
+
 } // namespace aos::cm::networkmanager
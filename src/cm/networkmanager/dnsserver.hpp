@@ -7,12 +7,14 @@
 #ifndef AOS_CM_NETWORKMANAGER_DNSSERVER_HPP_
 #define AOS_CM_NETWORKMANAGER_DNSSERVER_HPP_
 
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include <Poco/Process.h>
 
 #include <core/common/tools/error.hpp>
+#include <core/common/tools/timer.hpp>
 
 #include "itf/dnsserver.hpp"
 
@@ -20,6 +22,9 @@ namespace aos::cm::networkmanager {
 
 /**
  * DNS server.
+ *
+ * Hosts updates are coalesced: the hosts file is atomically replaced and the DNS server is reloaded once per reload
+ * delay, and only if hosts have been changed since the last reload.
  */
 class DNSServer : public DNSServerItf {
 public:
@@ -28,14 +33,21 @@ public:
      */
     DNSServer() = default;
 
+    /**
+     * Destructor. Applies pending hosts changes.
+     */
+    ~DNSServer();
+
     /**
      * Initializes DNS server.
      *
      * @param dnsStoragePath DNS storage path.
      * @param dnsPidFile DNS PID file.
      * @param IP IP.
+     * @param reloadDelay delay used to coalesce hosts changes, changes are applied on restart if zero.
      */
-    void Init(const std::string& dnsStoragePath, const std::string& dnsPidFile, const std::string& dnsIP);
+    void Init(const std::string& dnsStoragePath, const std::string& dnsPidFile, const std::string& dnsIP,
+        Duration reloadDelay = cDefaultReloadDelay);
 
     /**
      * Updates hosts file.
@@ -46,7 +58,8 @@ public:
     Error UpdateHostsFile(const HostsMap& hosts) override;
 
     /**
-     * Restarts DNS server.
+     * Restarts DNS server. With non-zero reload delay the restart is deferred: success is returned once the restart is
+     * scheduled and an error of the deferred restart is only logged.
      *
      * @return Error.
      */
@@ -59,16 +72,30 @@ public:
      */
     std::string GetIP() const override;
 
+    /**
+     * Default reload delay.
+     */
+    static constexpr Duration cDefaultReloadDelay = Time::cMilliseconds * 100;
+
 private:
     static constexpr auto cHostFileName = "addnhosts";
     static constexpr auto cPidFileName  = "pidfile";
 
     Poco::Process::PID FindServerProcess();
     void               RestartProcess(Poco::Process::PID pid);
+    Error              WriteHostsFile();
+    Error              Flush();
+    void               OnReloadTimer();
 
     std::string mDNSStoragePath;
     std::string mIP;
     std::string mDNSPidFile;
+    Duration    mReloadDelay {};
+    HostsMap    mHosts;
+    bool        mHostsApplied {};
+    bool        mReloadPending {};
+    std::mutex  mMutex;
+    aos::Timer  mReloadTimer;
 };
 
 } // namespace aos::cm::networkmanager
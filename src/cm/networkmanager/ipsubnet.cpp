@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <tuple>
 
 #include <common/utils/exception.hpp>
 #include <core/common/tools/array.hpp>
@@ -14,6 +15,17 @@
 
 namespace aos::cm::networkmanager {
 
+namespace {
+
+/***********************************************************************************************************************
+ * Constants
+ **********************************************************************************************************************/
+
+constexpr uint32_t cBitsPerWord = 64;
+constexpr uint64_t cFullWord    = ~uint64_t(0);
+
+} // namespace
+
 /**********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
@@ -35,25 +47,24 @@ std::string IpSubnet::GetAvailableSubnet(const std::string& networkID)
 
 std::string IpSubnet::GetAvailableIP(const std::string& networkID)
 {
+    uint32_t ip {};
+
     auto it = mUsedIPSubnets.find(networkID);
-    if (it == mUsedIPSubnets.end() || it->second.mIPs.empty()) {
+    if (it == mUsedIPSubnets.end() || !it->second.Allocate(ip)) {
         throw std::runtime_error("no available IP for network " + networkID);
     }
 
-    std::string ip = it->second.mIPs.front();
-    it->second.mIPs.pop_front();
-
-    return ip;
+    return UINT32ToIP(ip);
 }
 
 void IpSubnet::ReleaseIPToSubnet(const std::string& networkID, const std::string& ip)
 {
     auto it = mUsedIPSubnets.find(networkID);
-    if (it == mUsedIPSubnets.end()) {
+    if (it == mUsedIPSubnets.end() || ip.empty()) {
         return;
     }
 
-    it->second.mIPs.push_back(ip);
+    it->second.Release(IPToUINT32(ip));
 }
 
 void IpSubnet::ReleaseIPNetPool(const std::string& networkID)
@@ -72,18 +83,19 @@ void IpSubnet::RemoveAllocatedSubnet(
 {
     if (auto it = std::find(mPredefinedPrivateNetworks.begin(), mPredefinedPrivateNetworks.end(), subnet);
         it != mPredefinedPrivateNetworks.end()) {
-        mUsedIPSubnets[networkID] = Subnetwork {*it, GenerateSubnetIPs(*it)};
+        mUsedIPSubnets.insert_or_assign(networkID, Subnetwork(*it));
         mPredefinedPrivateNetworks.erase(it);
     }
 
-    for (auto it = IPs.begin(); it != IPs.end(); ++it) {
-        auto it2 = mUsedIPSubnets.find(networkID);
-        if (it2 == mUsedIPSubnets.end()) {
-            continue;
-        }
+    auto it = mUsedIPSubnets.find(networkID);
+    if (it == mUsedIPSubnets.end()) {
+        return;
+    }
 
-        auto& ips = it2->second.mIPs;
-        ips.erase(std::remove(ips.begin(), ips.end(), *it), ips.end());
+    for (const auto& ip : IPs) {
+        if (!ip.empty()) {
+            it->second.Reserve(IPToUINT32(ip));
+        }
     }
 }
 
@@ -99,7 +111,7 @@ std::string IpSubnet::RequestIPNetPool(const std::string& networkID)
 
     auto cidr = FindUnusedIPSubnet();
 
-    mUsedIPSubnets[networkID] = Subnetwork {cidr, GenerateSubnetIPs(cidr)};
+    mUsedIPSubnets.insert_or_assign(networkID, Subnetwork(cidr));
 
     return cidr;
 }
@@ -126,4 +138,67 @@ std::string IpSubnet::FindUnusedIPSubnet()
     throw std::runtime_error("no available network");
 }
 
+IpSubnet::Subnetwork::Subnetwork(const std::string& subnet)
+    : mSubnet(subnet)
+{
+    std::tie(mFirstIP, mCount) = GetSubnetIPRange(subnet);
+
+    mUsed.assign((mCount + cBitsPerWord - 1) / cBitsPerWord, 0);
+
+    // Mark tail bits of the last word as used, so they are never allocated.
+    if (auto tail = mCount % cBitsPerWord; tail != 0) {
+        mUsed.back() = cFullWord << tail;
+    }
+}
+
+bool IpSubnet::Subnetwork::Allocate(uint32_t& ip)
+{
+    for (; mFreeWord < mUsed.size(); mFreeWord++) {
+        auto& word = mUsed[mFreeWord];
+
+        if (word == cFullWord) {
+            continue;
+        }
+
+        auto bit = static_cast<uint32_t>(__builtin_ctzll(~word));
+
+        word |= uint64_t(1) << bit;
+        ip = mFirstIP + static_cast<uint32_t>(mFreeWord) * cBitsPerWord + bit;
+
+        return true;
+    }
+
+    return false;
+}
+
+void IpSubnet::Subnetwork::Release(uint32_t ip)
+{
+    auto index = GetBitIndex(ip);
+    if (index >= mCount) {
+        return;
+    }
+
+    mUsed[index / cBitsPerWord] &= ~(uint64_t(1) << (index % cBitsPerWord));
+    mFreeWord = std::min<size_t>(mFreeWord, index / cBitsPerWord);
+}
+
+void IpSubnet::Subnetwork::Reserve(uint32_t ip)
+{
+    auto index = GetBitIndex(ip);
+    if (index >= mCount) {
+        return;
+    }
+
+    mUsed[index / cBitsPerWord] |= uint64_t(1) << (index % cBitsPerWord);
+}
+
+uint32_t IpSubnet::Subnetwork::GetBitIndex(uint32_t ip) const
+{
+    if (ip < mFirstIP) {
+        return mCount;
+    }
+
+    return ip - mFirstIP;
+}
+
 } // namespace aos::cm::networkmanager
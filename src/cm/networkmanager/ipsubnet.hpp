@@ -7,7 +7,7 @@
 #ifndef AOS_CM_NETWORKMANAGER_IPSUBNET_HPP_
 #define AOS_CM_NETWORKMANAGER_IPSUBNET_HPP_
 
-#include <deque>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -75,9 +75,22 @@ public:
         const std::string& networkID, const std::string& subnet, const std::vector<std::string>& IPs);
 
 private:
+    /**
+     * Allocation bitmap of subnet IPs: bit set means IP is in use. The lowest free IP is always allocated first.
+     */
     struct Subnetwork {
-        std::string             mSubnet;
-        std::deque<std::string> mIPs;
+        explicit Subnetwork(const std::string& subnet);
+
+        bool     Allocate(uint32_t& ip);
+        void     Release(uint32_t ip);
+        void     Reserve(uint32_t ip);
+        uint32_t GetBitIndex(uint32_t ip) const;
+
+        std::string           mSubnet;
+        uint32_t              mFirstIP {};
+        uint32_t              mCount {};
+        std::vector<uint64_t> mUsed;
+        size_t                mFreeWord {};
     };
 
     std::string RequestIPNetPool(const std::string& networkID);
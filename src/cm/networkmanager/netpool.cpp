@@ -60,14 +60,6 @@ std::pair<uint32_t, int> ParseCIDRWithNetlink(const std::string& cidr)
     return {IP, prefix};
 }
 
-std::string UINT32ToIP(uint32_t ip)
-{
-    struct in_addr addr;
-    addr.s_addr = htonl(ip);
-
-    return std::string(inet_ntoa(addr));
-}
-
 std::vector<std::string> MakeNetPool(int targetPrefix, uint32_t baseIP, int basePrefix)
 {
     std::vector<std::string> result;
@@ -111,24 +103,10 @@ std::vector<std::string> GetNetPools()
     return pools;
 }
 
-std::deque<std::string> GenerateSubnetIPs(const std::string& cidr)
+std::pair<uint32_t, uint32_t> GetSubnetIPRange(const std::string& cidr)
 {
-    std::deque<std::string> result;
+    auto [base, prefixLen] = ParseCIDRWithNetlink(cidr);
 
-    nl_addr* subnet;
-    if (auto errSubnet = nl_addr_parse(cidr.c_str(), AF_INET, &subnet); errSubnet < 0) {
-        common::network::NLToAosException(errSubnet, "failed to parse subnet CIDR " + cidr);
-    }
-
-    [[maybe_unused]] auto cleanupSubnet = DeferRelease(subnet, [](nl_addr* subnet) { nl_addr_put(subnet); });
-
-    void* addrData = nl_addr_get_binary_addr(subnet);
-    if (!addrData) {
-        throw std::runtime_error("failed to get binary address from " + cidr);
-    }
-
-    uint32_t base      = ntohl(*reinterpret_cast<uint32_t*>(addrData));
-    int      prefixLen = nl_addr_get_prefixlen(subnet);
     uint32_t mask      = prefixLen == 0 ? 0 : 0xFFFFFFFF << (32 - prefixLen);
     uint32_t network   = base & mask;
     uint32_t broadcast = network | (~mask);
@@ -138,18 +116,33 @@ std::deque<std::string> GenerateSubnetIPs(const std::string& cidr)
         throw std::runtime_error("invalid subnet CIDR: " + cidr);
     }
 
-    uint32_t count = hostBits - 2;
+    // The first host address is reserved, allocatable addresses start from network + 2 and end before broadcast.
+    return {network + 2, hostBits - 2};
+}
 
-    for (uint32_t i = 1; i <= count; ++i) {
-        uint32_t ip = network + i + 1;
-        if (ip >= broadcast) {
-            break;
-        }
+uint32_t IPToUINT32(const std::string& ip)
+{
+    struct in_addr addr;
 
-        result.push_back(UINT32ToIP(ip));
+    if (inet_pton(AF_INET, ip.c_str(), &addr) != 1) {
+        throw std::invalid_argument("invalid IP address: " + ip);
     }
 
-    return result;
+    return ntohl(addr.s_addr);
+}
+
+std::string UINT32ToIP(uint32_t ip)
+{
+    struct in_addr addr;
+    char           buffer[INET_ADDRSTRLEN];
+
+    addr.s_addr = htonl(ip);
+
+    if (!inet_ntop(AF_INET, &addr, buffer, sizeof(buffer))) {
+        throw std::runtime_error("failed to convert IP address");
+    }
+
+    return buffer;
 }
 
 } // namespace aos::cm::networkmanager
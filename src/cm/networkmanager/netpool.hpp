@@ -7,8 +7,9 @@
 #ifndef AOS_CM_NETWORKMANAGER_NETPOOL_HPP_
 #define AOS_CM_NETWORKMANAGER_NETPOOL_HPP_
 
-#include <deque>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace aos::cm::networkmanager {
@@ -21,12 +22,28 @@ namespace aos::cm::networkmanager {
 std::vector<std::string> GetNetPools();
 
 /**
- * Generates IP addresses for a subnet.
+ * Returns range of allocatable IP addresses of a subnet.
  *
  * @param cidr CIDR of the subnet.
- * @return Vector of IP addresses.
+ * @return pair of first IP address and number of IP addresses.
  */
-std::deque<std::string> GenerateSubnetIPs(const std::string& cidr);
+std::pair<uint32_t, uint32_t> GetSubnetIPRange(const std::string& cidr);
+
+/**
+ * Converts IP address string to host order integer.
+ *
+ * @param ip IP address.
+ * @return IP address as integer.
+ */
+uint32_t IPToUINT32(const std::string& ip);
+
+/**
+ * Converts host order integer to IP address string.
+ *
+ * @param ip IP address as integer.
+ * @return IP address.
+ */
+std::string UINT32ToIP(uint32_t ip);
 
 } // namespace aos::cm::networkmanager
 
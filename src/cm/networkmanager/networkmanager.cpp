@@ -729,9 +729,9 @@ bool NetworkManager::MigrateInstanceFromOtherNode(const InstanceIdent& instanceI
 
 void NetworkManager::RemoveExistedNetworks()
 {
-    std::vector<std::string> IPs;
-
     for (auto& [networkID, networkState] : mNetworkStates) {
+        std::vector<std::string> IPs;
+
         for (auto& [nodeID, hostInstances] : networkState.mHostInstances) {
             IPs.push_back(hostInstances.mHostInfo.mIP.CStr());
 
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <cm/networkmanager/dnsserver.hpp>
+
+using namespace testing;
+
+namespace aos::cm::networkmanager {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cDNSIP = "172.17.0.1";
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+std::atomic<int> sNumReloads {};
+
+void OnReload(int)
+{
+    sNumReloads++;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class DNSServerTest : public Test {
+protected:
+    void SetUp() override
+    {
+        tests::utils::InitLog();
+
+        mTempDir = std::filesystem::temp_directory_path() / ("aos-cm-dnsserver-" + std::to_string(::getpid()));
+
+        std::filesystem::remove_all(mTempDir);
+        std::filesystem::create_directories(mTempDir);
+
+        // DNS server is reloaded with SIGHUP, the test process plays its role.
+        std::ofstream(mTempDir / "pidfile") << ::getpid();
+
+        mPrevHandler = std::signal(SIGHUP, OnReload);
+        sNumReloads  = 0;
+    }
+
+    void TearDown() override
+    {
+        std::signal(SIGHUP, mPrevHandler);
+        std::filesystem::remove_all(mTempDir);
+    }
+
+    std::string ReadHosts() const
+    {
+        std::ifstream file(mTempDir / "addnhosts");
+
+        return std::string(std::istreambuf_iterator<char>(file), {});
+    }
+
+    bool WaitReloads(int numReloads) const
+    {
+        for (auto i = 0; i < 100 && sNumReloads < numReloads; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        return sNumReloads == numReloads;
+    }
+
+    std::filesystem::path mTempDir;
+    void (*mPrevHandler)(int) {};
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(DNSServerTest, ReloadDelayCoalescesRestarts)
+{
+    DNSServer dnsServer;
+
+    dnsServer.Init(mTempDir.string(), (mTempDir / "pidfile").string(), cDNSIP, Time::cMilliseconds * 50);
+
+    ASSERT_TRUE(dnsServer.UpdateHostsFile({{"10.0.0.5", {"app1"}}}).IsNone());
+    ASSERT_TRUE(dnsServer.Restart().IsNone());
+    ASSERT_TRUE(dnsServer.UpdateHostsFile({{"10.0.0.6", {"app2"}}}).IsNone());
+    ASSERT_TRUE(dnsServer.Restart().IsNone());
+
+    EXPECT_EQ(sNumReloads, 0);
+    EXPECT_TRUE(ReadHosts().empty());
+
+    ASSERT_TRUE(WaitReloads(1));
+
+    EXPECT_EQ(ReadHosts(), "10.0.0.6\tapp2\n");
+
+    for (const auto& entry : std::filesystem::directory_iterator(mTempDir)) {
+        EXPECT_NE(entry.path().filename().string().rfind(".addnhosts.", 0), 0);
+    }
+
+    // Restart without hosts changes doesn't reload DNS server.
+    ASSERT_TRUE(dnsServer.UpdateHostsFile({{"10.0.0.6", {"app2"}}}).IsNone());
+    ASSERT_TRUE(dnsServer.Restart().IsNone());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(sNumReloads, 1);
+}
+
+TEST_F(DNSServerTest, DestructorAppliesPendingHosts)
+{
+    {
+        DNSServer dnsServer;
+
+        dnsServer.Init(mTempDir.string(), (mTempDir / "pidfile").string(), cDNSIP, Time::cSeconds * 10);
+
+        ASSERT_TRUE(dnsServer.UpdateHostsFile({{"10.0.0.5", {"app1"}}}).IsNone());
+        ASSERT_TRUE(dnsServer.Restart().IsNone());
+
+        EXPECT_EQ(sNumReloads, 0);
+    }
+
+    EXPECT_TRUE(WaitReloads(1));
+    EXPECT_EQ(ReadHosts(), "10.0.0.5\tapp1\n");
+}
+
+} // namespace aos::cm::networkmanager
@@ -1334,4 +1334,40 @@ TEST_F(CMNetworkManagerTest, SyncNetworkState_ConfirmedPendingCleanedFromDB)
     EXPECT_TRUE(err.IsNone());
 }
 
+TEST(CMIpSubnetTest, AllocateLowestFreeIP)
+{
+    IpSubnet ipSubnet;
+
+    ipSubnet.Init();
+    ipSubnet.RemoveAllocatedSubnet("network1", "172.17.0.0/16", {"172.17.0.2", "172.17.0.4", ""});
+
+    EXPECT_EQ(ipSubnet.GetAvailableSubnet("network1"), "172.17.0.0/16");
+    EXPECT_EQ(ipSubnet.GetAvailableIP("network1"), "172.17.0.3");
+    EXPECT_EQ(ipSubnet.GetAvailableIP("network1"), "172.17.0.5");
+
+    ipSubnet.ReleaseIPToSubnet("network1", "172.17.0.2");
+    ipSubnet.ReleaseIPToSubnet("network1", "172.18.0.2");
+
+    EXPECT_EQ(ipSubnet.GetAvailableIP("network1"), "172.17.0.2");
+    EXPECT_EQ(ipSubnet.GetAvailableIP("network1"), "172.17.0.6");
+
+    for (auto i = 7; i < 256; i++) {
+        EXPECT_EQ(ipSubnet.GetAvailableIP("network1"), "172.17.0." + std::to_string(i));
+    }
+
+    EXPECT_EQ(ipSubnet.GetAvailableIP("network1"), "172.17.1.0");
+
+    EXPECT_THROW(ipSubnet.GetAvailableIP("network2"), std::runtime_error);
+}
+
+TEST(CMIpSubnetTest, SubnetIPRange)
+{
+    auto [firstIP, count] = GetSubnetIPRange("10.0.0.0/29");
+
+    EXPECT_EQ(UINT32ToIP(firstIP), "10.0.0.2");
+    EXPECT_EQ(count, 5u);
+    EXPECT_EQ(IPToUINT32("10.0.0.2"), firstIP);
+    EXPECT_THROW(GetSubnetIPRange("10.0.0.0/31"), std::runtime_error);
+}
+
 } // namespace aos::cm::networkmanager
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <cm/smcontroller/smcontroller.hpp>
+#include <common/utils/exception.hpp>
+
+#include "../tests/stubs/alertsreceiverstub.hpp"
+#include "../tests/stubs/certloaderstub.hpp"
+#include "../tests/stubs/certproviderstub.hpp"
+#include "../tests/stubs/cloudconnectionstub.hpp"
+#include "../tests/stubs/instancestatusreceiverstub.hpp"
+#include "../tests/stubs/iteminfoproviderstub.hpp"
+#include "../tests/stubs/launchersenderstub.hpp"
+#include "../tests/stubs/monitoringreceiverstub.hpp"
+#include "../tests/stubs/networkproviderstub.hpp"
+#include "../tests/stubs/smclientstub.hpp"
+#include "../tests/stubs/smcontrollersenderstub.hpp"
+#include "../tests/stubs/sminforeceiverstub.hpp"
+#include "../tests/stubs/x509providerstub.hpp"
+
+namespace aos::cm::smcontroller {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cNodeID    = "main";
+constexpr auto cServerURL = "localhost:8095";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+// SM controller connected to in-process SM client over a real gRPC stream.
+class Environment {
+public:
+    Error Start()
+    {
+        mConfig.mCMServerURL = cServerURL;
+
+        auto err = mSMController.Init(mConfig, mCloudConnection, mCertProvider, mCertLoader, mX509Provider,
+            mItemInfoProvider, mAlertsReceiver, mSMControllerSender, mLauncherSender, mMonitoringReceiver,
+            mInstanceStatusReceiver, mSMInfoReceiver, mNetworkProvider, true);
+        if (!err.IsNone()) {
+            return err;
+        }
+
+        if (err = mSMController.Start(); !err.IsNone()) {
+            return err;
+        }
+
+        if (err = mClient.Init(cNodeID); !err.IsNone()) {
+            return err;
+        }
+
+        if (err = mClient.Start(mConfig.mCMServerURL); !err.IsNone()) {
+            return err;
+        }
+
+        return mSMInfoReceiver.WaitSMInfo(cNodeID);
+    }
+
+    void Stop()
+    {
+        mClient.Stop();
+        mSMController.Stop();
+    }
+
+    SMController& GetSMController() { return mSMController; }
+
+private:
+    SMController mSMController;
+    Config       mConfig;
+    SMClientStub mClient;
+
+    CloudConnectionStub                  mCloudConnection;
+    iamclient::CertProviderStub          mCertProvider;
+    crypto::CertLoaderStub               mCertLoader;
+    crypto::x509::ProviderStub           mX509Provider;
+    ItemInfoProviderStub                 mItemInfoProvider;
+    alerts::ReceiverStub                 mAlertsReceiver;
+    SenderStub                           mSMControllerSender;
+    launcher::SenderStub                 mLauncherSender;
+    monitoring::ReceiverStub             mMonitoringReceiver;
+    launcher::InstanceStatusReceiverStub mInstanceStatusReceiver;
+    nodeinfoprovider::SMInfoReceiverStub mSMInfoReceiver;
+    NetworkProviderStub                  mNetworkProvider;
+};
+
+std::unique_ptr<Environment> sEnvironment;
+
+void SetupEnvironment(const benchmark::State&)
+{
+    sEnvironment = std::make_unique<Environment>();
+
+    AOS_ERROR_CHECK_AND_THROW(sEnvironment->Start(), "can't start environment");
+}
+
+void TeardownEnvironment(const benchmark::State&)
+{
+    sEnvironment->Stop();
+    sEnvironment.reset();
+}
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+// Concurrent synchronous requests to the same node share one stream and one response queue.
+void BM_GetNodeConfigStatus(benchmark::State& state)
+{
+    NodeConfigStatus status;
+
+    for (auto _ : state) {
+        if (auto err = sEnvironment->GetSMController().GetNodeConfigStatus(cNodeID, status); !err.IsNone()) {
+            state.SkipWithError(err.Message());
+
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_GetNodeConfigStatus)
+    ->Setup(SetupEnvironment)
+    ->Teardown(TeardownEnvironment)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->UseRealTime();
+
+} // namespace
+
+} // namespace aos::cm::smcontroller
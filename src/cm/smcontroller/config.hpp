@@ -9,6 +9,10 @@
 
 #include <string>
 
+#include <core/common/tools/time.hpp>
+
+#include "monitoringstore.hpp"
+
 namespace aos::cm::smcontroller {
 
 /**
@@ -18,6 +22,10 @@ struct Config {
     std::string mCMServerURL;
     std::string mCertStorage;
     std::string mCACert;
+    // Node average monitoring window. It is used instead of the node SM one while instant monitoring samples are
+    // available, so the history size should cover it.
+    Duration    mMonitoringAverageWindow {};
+    size_t      mMonitoringHistorySize = MonitoringStore::cDefaultMaxSamples;
 };
 
 } // namespace aos::cm::smcontroller
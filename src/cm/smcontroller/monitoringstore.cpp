@@ -0,0 +1,342 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include <core/common/tools/logger.hpp>
+
+#include "monitoringstore.hpp"
+
+namespace aos::cm::smcontroller {
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+void MonitoringStore::Init(size_t maxSamples)
+{
+    LOG_DBG() << "Init monitoring store" << Log::Field("maxSamples", maxSamples);
+
+    std::lock_guard lock {mMutex};
+
+    mMaxSamples = std::max<size_t>(maxSamples, 1);
+
+    mNodes.clear();
+}
+
+Error MonitoringStore::AddSample(const aos::monitoring::NodeMonitoringData& monitoring)
+{
+    std::lock_guard lock {mMutex};
+
+    auto timestamp = Now();
+    auto it        = mNodes.find(monitoring.mNodeID.CStr());
+
+    if (it == mNodes.end()) {
+        it = mNodes.emplace(monitoring.mNodeID.CStr(), NodeSeries {Series(mMaxSamples), {}}).first;
+    }
+
+    auto& node = it->second;
+
+    node.mSeries.Add(timestamp, monitoring.mMonitoringData);
+
+    // Stopped instances are not reported by SM, their samples are dropped to not affect node averages.
+    node.mInstances.erase(std::remove_if(node.mInstances.begin(), node.mInstances.end(),
+                              [&monitoring](const InstanceSeries& instance) {
+                                  return std::none_of(monitoring.mInstances.begin(), monitoring.mInstances.end(),
+                                      [&instance](const aos::monitoring::InstanceMonitoringData& data) {
+                                          return data.mInstanceIdent == instance.mInstanceIdent;
+                                      });
+                              }),
+        node.mInstances.end());
+
+    for (const auto& data : monitoring.mInstances) {
+        auto instance = std::find_if(node.mInstances.begin(), node.mInstances.end(),
+            [&data](const InstanceSeries& item) { return item.mInstanceIdent == data.mInstanceIdent; });
+
+        if (instance == node.mInstances.end()) {
+            instance = node.mInstances.insert(
+                node.mInstances.end(), InstanceSeries {data.mInstanceIdent, {}, Series(mMaxSamples)});
+        }
+
+        instance->mRuntimeID = data.mRuntimeID.CStr();
+        instance->mSeries.Add(timestamp, data.mMonitoringData);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+void MonitoringStore::RemoveNode(const String& nodeID)
+{
+    std::lock_guard lock {mMutex};
+
+    mNodes.erase(nodeID.CStr());
+}
+
+Error MonitoringStore::GetAverage(
+    const String& nodeID, Duration window, aos::monitoring::NodeMonitoringData& monitoring) const
+{
+    std::lock_guard lock {mMutex};
+
+    const auto* node = FindNode(nodeID);
+    const auto  from = WindowStart(window);
+
+    if (node == nullptr || node->mSeries.NumSamples(from) == 0) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no monitoring samples"));
+    }
+
+    if (auto err = monitoring.mNodeID.Assign(nodeID); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    monitoring.mTimestamp                 = Time::Now();
+    monitoring.mMonitoringData.mTimestamp = monitoring.mTimestamp;
+
+    node->mSeries.GetAverage(from, monitoring.mMonitoringData);
+
+    monitoring.mInstances.Clear();
+
+    for (const auto& instance : node->mInstances) {
+        if (instance.mSeries.NumSamples(from) == 0) {
+            continue;
+        }
+
+        if (auto err = monitoring.mInstances.EmplaceBack(); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        auto& data = monitoring.mInstances.Back();
+
+        data.mInstanceIdent             = instance.mInstanceIdent;
+        data.mMonitoringData.mTimestamp = monitoring.mTimestamp;
+
+        if (auto err = data.mRuntimeID.Assign(instance.mRuntimeID.c_str()); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        instance.mSeries.GetAverage(from, data.mMonitoringData);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+RetWithError<double> MonitoringStore::GetPercentile(
+    const String& nodeID, MonitoringParam param, double percentile, Duration window) const
+{
+    std::lock_guard lock {mMutex};
+
+    const auto* node = FindNode(nodeID);
+    if (node == nullptr) {
+        return {0, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no monitoring samples"))};
+    }
+
+    return GetSeriesPercentile(node->mSeries, param, percentile, WindowStart(window));
+}
+
+RetWithError<double> MonitoringStore::GetPercentile(const String& nodeID, const InstanceIdent& instanceIdent,
+    MonitoringParam param, double percentile, Duration window) const
+{
+    std::lock_guard lock {mMutex};
+
+    const auto* node = FindNode(nodeID);
+    if (node == nullptr) {
+        return {0, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no monitoring samples"))};
+    }
+
+    auto instance = std::find_if(node->mInstances.begin(), node->mInstances.end(),
+        [&instanceIdent](const InstanceSeries& item) { return item.mInstanceIdent == instanceIdent; });
+    if (instance == node->mInstances.end()) {
+        return {0, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no monitoring samples"))};
+    }
+
+    return GetSeriesPercentile(instance->mSeries, param, percentile, WindowStart(window));
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+MonitoringStore::Series::Series(size_t capacity)
+    : mTimestamps(capacity)
+    , mCPU(capacity)
+    , mRAM(capacity)
+    , mDownload(capacity)
+    , mUpload(capacity)
+{
+}
+
+void MonitoringStore::Series::Add(int64_t timestamp, const MonitoringData& data)
+{
+    const auto capacity = mTimestamps.size();
+
+    mTimestamps[mNext] = timestamp;
+    mCPU[mNext]        = data.mCPU;
+    mRAM[mNext]        = data.mRAM;
+    mDownload[mNext]   = data.mDownload;
+    mUpload[mNext]     = data.mUpload;
+
+    for (auto& column : mPartitions) {
+        column.mUsedSize[mNext] = 0;
+    }
+
+    for (const auto& partition : data.mPartitions) {
+        auto column = std::find_if(mPartitions.begin(), mPartitions.end(),
+            [&partition](const PartitionColumn& item) { return item.mName == partition.mName.CStr(); });
+
+        if (column == mPartitions.end()) {
+            column = mPartitions.insert(
+                mPartitions.end(), PartitionColumn {partition.mName.CStr(), std::vector<uint64_t>(capacity)});
+        }
+
+        column->mUsedSize[mNext] = partition.mUsedSize;
+    }
+
+    mNext  = (mNext + 1) % capacity;
+    mCount = std::min(mCount + 1, capacity);
+}
+
+size_t MonitoringStore::Series::Slot(size_t index) const
+{
+    const auto capacity = mTimestamps.size();
+
+    return (mNext + capacity - mCount + index) % capacity;
+}
+
+size_t MonitoringStore::Series::NumSamples(int64_t from) const
+{
+    size_t numSamples = 0;
+
+    // Samples are added in time order, so the window is the newest samples.
+    while (numSamples < mCount && mTimestamps[Slot(mCount - numSamples - 1)] >= from) {
+        numSamples++;
+    }
+
+    return numSamples;
+}
+
+double MonitoringStore::Series::Value(MonitoringParam param, size_t slot) const
+{
+    switch (param) {
+    case MonitoringParam::eCPU:
+        return mCPU[slot];
+
+    case MonitoringParam::eRAM:
+        return static_cast<double>(mRAM[slot]);
+
+    case MonitoringParam::eDownload:
+        return static_cast<double>(mDownload[slot]);
+
+    case MonitoringParam::eUpload:
+        return static_cast<double>(mUpload[slot]);
+    }
+
+    return 0;
+}
+
+void MonitoringStore::Series::GetAverage(int64_t from, MonitoringData& data) const
+{
+    const auto numSamples = NumSamples(from);
+    if (numSamples == 0) {
+        return;
+    }
+
+    double   cpu      = 0;
+    uint64_t ram      = 0;
+    uint64_t download = 0;
+    uint64_t upload   = 0;
+
+    for (auto i = mCount - numSamples; i < mCount; i++) {
+        const auto slot = Slot(i);
+
+        cpu += mCPU[slot];
+        ram += mRAM[slot];
+        download += mDownload[slot];
+        upload += mUpload[slot];
+    }
+
+    data.mCPU      = cpu / numSamples;
+    data.mRAM      = ram / numSamples;
+    data.mDownload = download / numSamples;
+    data.mUpload   = upload / numSamples;
+
+    data.mPartitions.Clear();
+
+    for (const auto& column : mPartitions) {
+        uint64_t usedSize = 0;
+
+        for (auto i = mCount - numSamples; i < mCount; i++) {
+            usedSize += column.mUsedSize[Slot(i)];
+        }
+
+        if (auto err = data.mPartitions.EmplaceBack(); !err.IsNone()) {
+            LOG_WRN() << "Can't add partition average" << Log::Field(AOS_ERROR_WRAP(err));
+
+            return;
+        }
+
+        data.mPartitions.Back().mName     = column.mName.c_str();
+        data.mPartitions.Back().mUsedSize = usedSize / numSamples;
+    }
+}
+
+int64_t MonitoringStore::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int64_t MonitoringStore::WindowStart(Duration window)
+{
+    if (window.Nanoseconds() <= 0) {
+        return std::numeric_limits<int64_t>::min();
+    }
+
+    return Now() - window.Nanoseconds();
+}
+
+RetWithError<double> MonitoringStore::GetSeriesPercentile(
+    const Series& series, MonitoringParam param, double percentile, int64_t from)
+{
+    if (percentile < 0 || percentile > 100) {
+        return {0, AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "percentile out of range"))};
+    }
+
+    const auto numSamples = series.NumSamples(from);
+    if (numSamples == 0) {
+        return {0, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no monitoring samples"))};
+    }
+
+    std::vector<double> values;
+
+    values.reserve(numSamples);
+
+    for (auto i = series.Size() - numSamples; i < series.Size(); i++) {
+        values.push_back(series.Value(param, series.Slot(i)));
+    }
+
+    // Nearest-rank percentile.
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100 * numSamples));
+
+    rank = rank == 0 ? 0 : rank - 1;
+
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+
+    return values[rank];
+}
+
+const MonitoringStore::NodeSeries* MonitoringStore::FindNode(const String& nodeID) const
+{
+    auto it = mNodes.find(nodeID.CStr());
+    if (it == mNodes.end()) {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+} // namespace aos::cm::smcontroller
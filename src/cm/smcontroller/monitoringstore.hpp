@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CM_SMCONTROLLER_MONITORINGSTORE_HPP_
+#define AOS_CM_SMCONTROLLER_MONITORINGSTORE_HPP_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <core/common/monitoring/itf/monitoringdata.hpp>
+#include <core/common/tools/time.hpp>
+#include <core/common/types/monitoring.hpp>
+
+namespace aos::cm::smcontroller {
+
+/**
+ * Monitoring parameter.
+ */
+enum class MonitoringParam { eCPU, eRAM, eDownload, eUpload };
+
+/**
+ * Keeps recent monitoring samples received from SMs and computes windowed statistics locally.
+ *
+ * Node and instance samples are stored per node in fixed-size columnar ring buffers, so adding a sample doesn't
+ * allocate once the buffers are filled. Samples are timestamped with the CM monotonic receive time.
+ */
+class MonitoringStore {
+public:
+    static constexpr size_t cDefaultMaxSamples = 64;
+
+    /**
+     * Initializes monitoring store.
+     *
+     * @param maxSamples max number of samples kept per node and instance.
+     */
+    void Init(size_t maxSamples = cDefaultMaxSamples);
+
+    /**
+     * Adds node monitoring sample. Instances absent in the sample are removed.
+     *
+     * @param monitoring node monitoring data.
+     * @return Error.
+     */
+    Error AddSample(const aos::monitoring::NodeMonitoringData& monitoring);
+
+    /**
+     * Removes node samples.
+     *
+     * @param nodeID node ID.
+     */
+    void RemoveNode(const String& nodeID);
+
+    /**
+     * Returns average node and instances monitoring over the window.
+     *
+     * @param nodeID node ID.
+     * @param window averaging window, all kept samples are used if 0.
+     * @param[out] monitoring average monitoring.
+     * @return Error.
+     */
+    Error GetAverage(const String& nodeID, Duration window, aos::monitoring::NodeMonitoringData& monitoring) const;
+
+    /**
+     * Returns node parameter percentile over the window.
+     *
+     * @param nodeID node ID.
+     * @param param monitoring parameter.
+     * @param percentile percentile in range [0, 100].
+     * @param window window, all kept samples are used if 0.
+     * @return RetWithError<double>.
+     */
+    RetWithError<double> GetPercentile(
+        const String& nodeID, MonitoringParam param, double percentile, Duration window) const;
+
+    /**
+     * Returns instance parameter percentile over the window.
+     *
+     * @param nodeID node ID.
+     * @param instanceIdent instance ident.
+     * @param param monitoring parameter.
+     * @param percentile percentile in range [0, 100].
+     * @param window window, all kept samples are used if 0.
+     * @return RetWithError<double>.
+     */
+    RetWithError<double> GetPercentile(const String& nodeID, const InstanceIdent& instanceIdent, MonitoringParam param,
+        double percentile, Duration window) const;
+
+private:
+    struct PartitionColumn {
+        std::string           mName;
+        std::vector<uint64_t> mUsedSize;
+    };
+
+    class Series {
+    public:
+        explicit Series(size_t capacity);
+
+        void   Add(int64_t timestamp, const MonitoringData& data);
+        size_t Size() const { return mCount; }
+        size_t Slot(size_t index) const;
+        size_t NumSamples(int64_t from) const;
+        double Value(MonitoringParam param, size_t slot) const;
+        void   GetAverage(int64_t from, MonitoringData& data) const;
+
+    private:
+        std::vector<int64_t>         mTimestamps;
+        std::vector<double>          mCPU;
+        std::vector<uint64_t>        mRAM;
+        std::vector<uint64_t>        mDownload;
+        std::vector<uint64_t>        mUpload;
+        std::vector<PartitionColumn> mPartitions;
+        size_t                       mNext {};
+        size_t                       mCount {};
+    };
+
+    struct InstanceSeries {
+        InstanceIdent mInstanceIdent;
+        std::string   mRuntimeID;
+        Series        mSeries;
+    };
+
+    struct NodeSeries {
+        Series                      mSeries;
+        std::vector<InstanceSeries> mInstances;
+    };
+
+    static int64_t              Now();
+    static int64_t              WindowStart(Duration window);
+    static RetWithError<double> GetSeriesPercentile(
+        const Series& series, MonitoringParam param, double percentile, int64_t from);
+
+    const NodeSeries* FindNode(const String& nodeID) const;
+
+    mutable std::mutex                mMutex;
+    size_t                            mMaxSamples = cDefaultMaxSamples;
+    std::map<std::string, NodeSeries> mNodes;
+};
+
+} // namespace aos::cm::smcontroller
+
+#endif
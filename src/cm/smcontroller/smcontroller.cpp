@@ -50,6 +50,8 @@ Error SMController::Init(const Config& config, cloudconnection::CloudConnectionI
     mNetworkProvider        = &networkProvider;
     mInsecureConn           = insecureConn;
 
+    mMonitoringStore.Init(mConfig.mMonitoringHistorySize);
+
     return ErrorEnum::eNone;
 }
 
@@ -203,6 +205,12 @@ Error SMController::GetAverageMonitoring(const String& nodeID, aos::monitoring::
 {
     LOG_DBG() << "Getting average monitoring" << Log::Field("nodeID", nodeID.CStr());
 
+    // Instant monitoring received from SM is used if available, SM is requested otherwise.
+    auto err = mMonitoringStore.GetAverage(nodeID, mConfig.mMonitoringAverageWindow, monitoring);
+    if (!err.Is(ErrorEnum::eNotFound)) {
+        return err;
+    }
+
     SMHandler* handler = FindNode(nodeID);
     if (!handler) {
         return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "node not found"));
@@ -215,6 +223,24 @@ Error SMController::GetAverageMonitoring(const String& nodeID, aos::monitoring::
     return ErrorEnum::eNone;
 }
 
+Error SMController::GetQueuesStats(const String& nodeID, SMHandler::QueuesStats& stats)
+{
+    SMHandler* handler = FindNode(nodeID);
+    if (!handler) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "node not found"));
+    }
+
+    stats = handler->GetQueuesStats();
+
+    return ErrorEnum::eNone;
+}
+
+RetWithError<double> SMController::GetMonitoringPercentile(
+    const String& nodeID, MonitoringParam param, double percentile, Duration window) const
+{
+    return mMonitoringStore.GetPercentile(nodeID, param, percentile, window);
+}
+
 /***********************************************************************************************************************
  * ConnectionListenerItf implementation
  **********************************************************************************************************************/
@@ -241,6 +267,19 @@ void SMController::OnDisconnect()
     }
 }
 
+/***********************************************************************************************************************
+ * monitoring::ReceiverItf implementation
+ **********************************************************************************************************************/
+
+Error SMController::OnMonitoringReceived(const aos::monitoring::NodeMonitoringData& monitoring)
+{
+    if (auto err = mMonitoringStore.AddSample(monitoring); !err.IsNone()) {
+        LOG_ERR() << "Can't store monitoring" << Log::Field("nodeID", monitoring.mNodeID) << Log::Field(err);
+    }
+
+    return mMonitoringReceiver->OnMonitoringReceived(monitoring);
+}
+
 /***********************************************************************************************************************
  * Private
  **********************************************************************************************************************/
@@ -251,7 +290,7 @@ grpc::Status SMController::RegisterSM(grpc::ServerContext*
     LOG_INF() << "SM registration request received";
 
     auto handler = std::make_shared<SMHandler>(context, stream, *mAlertsReceiver, *mLogSender, *mEnvVarsStatusSender,
-        *mMonitoringReceiver, *mInstanceStatusReceiver, *mSMInfoReceiver,
+        static_cast<monitoring::ReceiverItf&>(*this), *mInstanceStatusReceiver, *mSMInfoReceiver,
         static_cast<NodeConnectionStatusListenerItf&>(*this));
 
     {
@@ -412,6 +451,8 @@ void SMController::OnNodeDisconnected(const String& nodeID)
         }
     }
 
+    mMonitoringStore.RemoveNode(nodeID);
+
     mSMInfoReceiver->OnSMDisconnected(nodeID, ErrorEnum::eNone);
 }
 
@@ -33,6 +33,7 @@
 #include <core/common/tools/timer.hpp>
 
 #include "config.hpp"
+#include "monitoringstore.hpp"
 #include "smhandler.hpp"
 
 namespace aos::cm::smcontroller {
@@ -43,6 +44,7 @@ namespace aos::cm::smcontroller {
 class SMController : public SMControllerItf,
                      public aos::networkmanager::PendingUpdateHandlerItf,
                      private cloudconnection::ConnectionListenerItf,
+                     private monitoring::ReceiverItf,
                      private NodeConnectionStatusListenerItf,
                      private aos::iamclient::CertListenerItf,
                      private servicemanager::v5::SMService::Service,
@@ -172,6 +174,27 @@ public:
     void OnPendingFirewallUpdate(
         const String& nodeID, const aos::networkmanager::PendingFirewallUpdate& update) override;
 
+    /**
+     * Returns SM message queues statistics for a node.
+     *
+     * @param nodeID Node ID.
+     * @param[out] stats Queues statistics indexed by SM handler lane.
+     * @return Error.
+     */
+    Error GetQueuesStats(const String& nodeID, SMHandler::QueuesStats& stats);
+
+    /**
+     * Returns node monitoring parameter percentile computed from received instant monitoring.
+     *
+     * @param nodeID Node ID.
+     * @param param monitoring parameter.
+     * @param percentile percentile in range [0, 100].
+     * @param window window, all kept samples are used if 0.
+     * @return RetWithError<double>.
+     */
+    RetWithError<double> GetMonitoringPercentile(
+        const String& nodeID, MonitoringParam param, double percentile, Duration window) const;
+
 private:
     static constexpr Duration cReconnectRetryTimeout = Time::cSeconds * 10;
 
@@ -182,6 +205,12 @@ private:
     void OnConnect() override;
     void OnDisconnect() override;
 
+    //
+    // monitoring::ReceiverItf interface methods
+    //
+
+    Error OnMonitoringReceived(const aos::monitoring::NodeMonitoringData& monitoring) override;
+
     //
     // SMService::Service GRPC service methods
     //
@@ -265,6 +294,8 @@ private:
 
     aos::Timer mReconnectTimer {};
 
+    MonitoringStore mMonitoringStore;
+
     // Stream writers for SubscribeInstanceNetworkUpdates per nodeID
     struct NetworkUpdateStream {
         grpc::ServerContext*                                                       mContext {};
@@ -15,6 +15,18 @@
 
 namespace aos::cm::smcontroller {
 
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+// Monitoring goes last: it is periodic and a newer message supersedes an older one.
+constexpr std::array<SMHandler::Lane, SMHandler::cNumLanes> cLanesPriority
+    = {SMHandler::Lane::eStatus, SMHandler::Lane::eAlert, SMHandler::Lane::eLog, SMHandler::Lane::eMonitoring};
+
+} // namespace
+
 /***********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
@@ -56,20 +68,18 @@ void SMHandler::Start()
             dst.mutable_average_monitoring()->CopyFrom(src.average_monitoring());
         });
 
-    mReadThread    = std::thread([this]() { ReadMessages(); });
-    mMessageThread = std::thread([this]() { ProcessMessages(); });
+    mProcessThread = std::thread([this]() { ProcessMessages(); });
 }
 
 void SMHandler::Wait()
 {
     LOG_DBG() << "Wait SM handler";
 
-    if (mReadThread.joinable()) {
-        mReadThread.join();
-    }
+    // The stream is read by the gRPC thread serving the call: it is blocked for the call lifetime anyway.
+    ReadMessages();
 
-    if (mMessageThread.joinable()) {
-        mMessageThread.join();
+    if (mProcessThread.joinable()) {
+        mProcessThread.join();
     }
 }
 
@@ -85,7 +95,10 @@ void SMHandler::Stop()
         mContext->TryCancel();
     }
 
-    mCondVar.notify_one();
+    mSyncMessageSender.Cancel();
+
+    mProcessCondVar.notify_one();
+    mQueueSpaceCondVar.notify_one();
 }
 
 String SMHandler::GetNodeID() const
@@ -211,20 +224,23 @@ Error SMHandler::RequestLog(const aos::RequestLog& log)
 void SMHandler::ReadMessages()
 {
     try {
-        servicemanager::v5::SMOutgoingMessages outgoingMsg;
+        while (true) {
+            auto queuedMessage = CreateMessage();
+
+            if (!mStream->Read(queuedMessage.mMessage)) {
+                break;
+            }
 
-        while (mStream->Read(&outgoingMsg)) {
-            if (auto err = mSyncMessageSender.ProcessResponse(outgoingMsg); err.HasValue()) {
+            if (auto err = mSyncMessageSender.ProcessResponse(*queuedMessage.mMessage); err.HasValue()) {
                 if (!err->IsNone()) {
                     LOG_ERR() << "Failed to process response" << Log::Field("nodeID", GetNodeID())
                               << Log::Field(AOS_ERROR_WRAP(*err));
                 }
-            } else {
-                std::lock_guard lock {mMutex};
 
-                mMessageQueue.push(outgoingMsg);
-                mCondVar.notify_one();
+                continue;
             }
+
+            PushMessage(std::move(queuedMessage));
         }
     } catch (const std::exception& e) {
         LOG_ERR() << "Handle incoming messages failed" << Log::Field(AOS_ERROR_WRAP(common::utils::ToAosError(e)));
@@ -235,7 +251,47 @@ void SMHandler::ReadMessages()
     std::lock_guard lock {mMutex};
 
     mStopProcessing = true;
-    mCondVar.notify_one();
+
+    mProcessCondVar.notify_one();
+}
+
+void SMHandler::PushMessage(QueuedMessage message)
+{
+    auto  lane  = GetLane(*message.mMessage);
+    auto& queue = mQueues[static_cast<size_t>(lane)];
+
+    std::unique_lock lock {mMutex};
+
+    // Only the status lane may block the reader: sync responses and status messages are read by this thread, so
+    // blocking on a full monitoring, log or alert lane would stall them. Those lanes drop the oldest message instead.
+    if (lane != Lane::eStatus && queue.mMessages.size() >= cMaxQueueSize) {
+        LOG_WRN() << "Message queue is full, drop oldest message" << Log::Field("nodeID", GetNodeID())
+                  << Log::Field("lane", static_cast<int>(lane));
+
+        queue.mMessages.pop_front();
+        queue.mStats.mDropped++;
+    }
+
+    // Stop reading the stream while the status lane is full: gRPC flow control pushes back on SM.
+    if (queue.mMessages.size() >= cMaxQueueSize) {
+        LOG_WRN() << "Message queue is full" << Log::Field("nodeID", GetNodeID())
+                  << Log::Field("lane", static_cast<int>(lane));
+
+        queue.mStats.mBlocked++;
+
+        mQueueSpaceCondVar.wait(lock, [&]() { return mStopProcessing || queue.mMessages.size() < cMaxQueueSize; });
+    }
+
+    if (mStopProcessing) {
+        return;
+    }
+
+    queue.mMessages.push_back(std::move(message));
+
+    queue.mStats.mDepth    = queue.mMessages.size();
+    queue.mStats.mMaxDepth = std::max(queue.mStats.mMaxDepth, queue.mStats.mDepth);
+
+    mProcessCondVar.notify_one();
 }
 
 void SMHandler::ProcessMessages()
@@ -244,38 +300,27 @@ void SMHandler::ProcessMessages()
         try {
             std::unique_lock lock {mMutex};
 
-            mCondVar.wait(lock, [this]() { return mStopProcessing || !mMessageQueue.empty(); });
+            mProcessCondVar.wait(lock, [&]() { return mStopProcessing || GetNextLane() != Lane::eNumLanes; });
 
             if (mStopProcessing) {
                 break;
             }
 
-            Error err;
-            auto  outgoingMsg = mMessageQueue.front();
+            auto& queue         = mQueues[static_cast<size_t>(GetNextLane())];
+            auto  queuedMessage = std::move(queue.mMessages.front());
+
+            queue.mMessages.pop_front();
+
+            queue.mStats.mDepth = queue.mMessages.size();
+            queue.mStats.mProcessed++;
 
-            mMessageQueue.pop();
+            mQueueSpaceCondVar.notify_one();
 
             // Process message without holding the lock to allow sending new messages in parallel
 
             lock.unlock();
 
-            if (outgoingMsg.has_sm_info()) {
-                err = ProcessSMInfo(outgoingMsg.sm_info());
-            } else if (outgoingMsg.has_update_instances_status()) {
-                err = ProcessUpdateInstancesStatus(outgoingMsg.update_instances_status());
-            } else if (outgoingMsg.has_node_instances_status()) {
-                err = ProcessNodeInstancesStatus(outgoingMsg.node_instances_status());
-            } else if (outgoingMsg.has_log()) {
-                err = ProcessLogData(outgoingMsg.log());
-            } else if (outgoingMsg.has_instant_monitoring()) {
-                err = ProcessInstantMonitoring(outgoingMsg.instant_monitoring());
-            } else if (outgoingMsg.has_alert()) {
-                err = ProcessAlert(outgoingMsg.alert());
-            } else {
-                LOG_WRN() << "Unknown message type received";
-            }
-
-            if (!err.IsNone()) {
+            if (auto err = ProcessMessage(*queuedMessage.mMessage); !err.IsNone()) {
                 LOG_ERR() << "Failed to process message" << Log::Field("nodeID", GetNodeID()) << Log::Field(err);
             }
         } catch (const std::exception& e) {
@@ -285,6 +330,84 @@ void SMHandler::ProcessMessages()
     }
 }
 
+Error SMHandler::ProcessMessage(const servicemanager::v5::SMOutgoingMessages& message)
+{
+    if (message.has_sm_info()) {
+        return ProcessSMInfo(message.sm_info());
+    }
+
+    if (message.has_update_instances_status()) {
+        return ProcessUpdateInstancesStatus(message.update_instances_status());
+    }
+
+    if (message.has_node_instances_status()) {
+        return ProcessNodeInstancesStatus(message.node_instances_status());
+    }
+
+    if (message.has_log()) {
+        return ProcessLogData(message.log());
+    }
+
+    if (message.has_instant_monitoring()) {
+        return ProcessInstantMonitoring(message.instant_monitoring());
+    }
+
+    if (message.has_alert()) {
+        return ProcessAlert(message.alert());
+    }
+
+    LOG_WRN() << "Unknown message type received";
+
+    return ErrorEnum::eNone;
+}
+
+SMHandler::Lane SMHandler::GetNextLane() const
+{
+    for (auto lane : cLanesPriority) {
+        // Only status lane is processed until SM info is received to keep node ID known to other lanes.
+        if (lane != Lane::eStatus && !mNodeConnected) {
+            break;
+        }
+
+        if (!mQueues[static_cast<size_t>(lane)].mMessages.empty()) {
+            return lane;
+        }
+    }
+
+    return Lane::eNumLanes;
+}
+
+SMHandler::Lane SMHandler::GetLane(const servicemanager::v5::SMOutgoingMessages& message)
+{
+    if (message.has_instant_monitoring()) {
+        return Lane::eMonitoring;
+    }
+
+    if (message.has_log()) {
+        return Lane::eLog;
+    }
+
+    if (message.has_alert()) {
+        return Lane::eAlert;
+    }
+
+    return Lane::eStatus;
+}
+
+SMHandler::QueuedMessage SMHandler::CreateMessage()
+{
+    google::protobuf::ArenaOptions options;
+
+    options.initial_block_size = cArenaInitialSize;
+
+    QueuedMessage queuedMessage {std::make_unique<google::protobuf::Arena>(options)};
+
+    queuedMessage.mMessage
+        = google::protobuf::Arena::CreateMessage<servicemanager::v5::SMOutgoingMessages>(queuedMessage.mArena.get());
+
+    return queuedMessage;
+}
+
 Error SMHandler::SendMessage(const servicemanager::v5::SMIncomingMessages& message)
 {
     std::lock_guard lock {mWriteMutex};
@@ -310,6 +433,12 @@ Error SMHandler::ProcessSMInfo(const servicemanager::v5::SMInfo& smInfo)
         mNodeID = aosSMInfo->mNodeID;
 
         mConnStatusListener->OnNodeConnected(GetNodeID());
+
+        std::lock_guard lock {mMutex};
+
+        mNodeConnected = true;
+
+        mProcessCondVar.notify_one();
     }
 
     if (auto err = mSMInfoReceiver->OnSMInfoReceived(*aosSMInfo); !err.IsNone()) {
@@ -479,4 +608,17 @@ void SMHandler::SendCloudConnectionStatus(bool connected)
     }
 }
 
+SMHandler::QueuesStats SMHandler::GetQueuesStats() const
+{
+    std::lock_guard lock {mMutex};
+
+    QueuesStats stats;
+
+    for (size_t i = 0; i < cNumLanes; i++) {
+        stats[i] = mQueues[i].mStats;
+    }
+
+    return stats;
+}
+
 } // namespace aos::cm::smcontroller
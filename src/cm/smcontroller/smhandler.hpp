@@ -7,13 +7,16 @@
 #ifndef AOS_CM_SMCONTROLLER_SMHANDLER_HPP_
 #define AOS_CM_SMCONTROLLER_SMHANDLER_HPP_
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 
+#include <google/protobuf/arena.h>
 #include <servicemanager/v5/servicemanager.grpc.pb.h>
 
 #include <common/utils/syncmessagesender.hpp>
@@ -41,6 +44,17 @@ struct Message {
     bool                                    mResponseReceived {};
 };
 
+/**
+ * SM message queue statistics.
+ */
+struct QueueStats {
+    size_t mDepth {};
+    size_t mMaxDepth {};
+    size_t mProcessed {};
+    size_t mBlocked {};
+    size_t mDropped {};
+};
+
 /**
  * Node connection status listener interface.
  */
@@ -68,6 +82,17 @@ public:
  */
 class SMHandler {
 public:
+    /**
+     * Message processing lanes. Each lane has its own bounded queue. Lanes are processed by one thread in the
+     * following priority order: status, alert, log, monitoring. A full status lane blocks reading the stream, other
+     * full lanes drop their oldest message.
+     */
+    enum class Lane { eStatus, eMonitoring, eLog, eAlert, eNumLanes };
+
+    static constexpr auto cNumLanes = static_cast<size_t>(Lane::eNumLanes);
+
+    using QueuesStats = std::array<QueueStats, cNumLanes>;
+
     /**
      * Constructor.
      *
@@ -93,7 +118,7 @@ public:
     void Start();
 
     /**
-     * Blocks until the node communication is stopped.
+     * Reads incoming messages in the caller thread and blocks until the node communication is stopped.
      */
     void Wait();
 
@@ -176,13 +201,39 @@ public:
      */
     void SendCloudConnectionStatus(bool connected);
 
+    /**
+     * Returns message queues statistics indexed by lane.
+     *
+     * @return QueuesStats.
+     */
+    QueuesStats GetQueuesStats() const;
+
 private:
-    static constexpr auto cResponseTime = std::chrono::seconds(5);
+    static constexpr auto   cResponseTime     = std::chrono::seconds(5);
+    static constexpr size_t cMaxQueueSize     = 64;
+    static constexpr size_t cArenaInitialSize = 4096;
+
+    // Each message owns its arena: all nested fields are freed at once when the message is processed.
+    struct QueuedMessage {
+        std::unique_ptr<google::protobuf::Arena> mArena;
+        servicemanager::v5::SMOutgoingMessages*  mMessage {};
+    };
+
+    struct MessageQueue {
+        std::deque<QueuedMessage> mMessages;
+        QueueStats                mStats;
+    };
+
+    static Lane          GetLane(const servicemanager::v5::SMOutgoingMessages& message);
+    static QueuedMessage CreateMessage();
 
     Error SendMessage(const servicemanager::v5::SMIncomingMessages& message);
 
-    void ReadMessages();
-    void ProcessMessages();
+    void  ReadMessages();
+    void  PushMessage(QueuedMessage message);
+    void  ProcessMessages();
+    Lane  GetNextLane() const;
+    Error ProcessMessage(const servicemanager::v5::SMOutgoingMessages& message);
 
     Error ProcessSMInfo(const servicemanager::v5::SMInfo& smInfo);
     Error ProcessUpdateInstancesStatus(const servicemanager::v5::UpdateInstancesStatus& status);
@@ -208,13 +259,14 @@ private:
     bool                 mCredentialListUpdated {};
     grpc::ServerContext* mCtx {};
 
-    std::mutex                                         mMutex;
-    std::mutex                                         mWriteMutex;
-    std::condition_variable                            mCondVar;
-    std::thread                                        mReadThread;
-    std::thread                                        mMessageThread;
-    bool                                               mStopProcessing {};
-    std::queue<servicemanager::v5::SMOutgoingMessages> mMessageQueue;
+    mutable std::mutex                  mMutex;
+    std::mutex                          mWriteMutex;
+    std::condition_variable             mQueueSpaceCondVar;
+    std::condition_variable             mProcessCondVar;
+    std::thread                         mProcessThread;
+    bool                                mStopProcessing {};
+    bool                                mNodeConnected {};
+    std::array<MessageQueue, cNumLanes> mQueues;
 
     StaticString<cIDLen> mNodeID;
 };
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <cm/smcontroller/monitoringstore.hpp>
+
+using namespace testing;
+
+namespace aos::cm::smcontroller {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cNodeID = "node0";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+InstanceIdent CreateInstanceIdent(const char* itemID, uint64_t instance)
+{
+    InstanceIdent ident;
+
+    ident.mItemID    = itemID;
+    ident.mSubjectID = "subject";
+    ident.mInstance  = instance;
+
+    return ident;
+}
+
+std::unique_ptr<aos::monitoring::NodeMonitoringData> CreateSample(
+    double cpu, size_t ram, const std::vector<InstanceIdent>& instances = {})
+{
+    auto sample = std::make_unique<aos::monitoring::NodeMonitoringData>();
+
+    sample->mNodeID              = cNodeID;
+    sample->mMonitoringData.mCPU = cpu;
+    sample->mMonitoringData.mRAM = ram;
+
+    sample->mMonitoringData.mPartitions.EmplaceBack();
+    sample->mMonitoringData.mPartitions.Back().mName     = "storage";
+    sample->mMonitoringData.mPartitions.Back().mUsedSize = ram / 2;
+
+    for (const auto& ident : instances) {
+        sample->mInstances.EmplaceBack();
+
+        sample->mInstances.Back().mInstanceIdent       = ident;
+        sample->mInstances.Back().mRuntimeID           = "runtime";
+        sample->mInstances.Back().mMonitoringData.mCPU = cpu / 2;
+        sample->mInstances.Back().mMonitoringData.mRAM = ram / 2;
+    }
+
+    return sample;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class MonitoringStoreTest : public Test {
+protected:
+    void SetUp() override { tests::utils::InitLog(); }
+
+    MonitoringStore                                      mStore;
+    std::unique_ptr<aos::monitoring::NodeMonitoringData> mAverage
+        = std::make_unique<aos::monitoring::NodeMonitoringData>();
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(MonitoringStoreTest, NoSamples)
+{
+    mStore.Init();
+
+    EXPECT_TRUE(mStore.GetAverage(cNodeID, {}, *mAverage).Is(ErrorEnum::eNotFound));
+    EXPECT_TRUE(mStore.GetPercentile(cNodeID, MonitoringParam::eCPU, 50, {}).mError.Is(ErrorEnum::eNotFound));
+}
+
+TEST_F(MonitoringStoreTest, GetAverage)
+{
+    const auto instance = CreateInstanceIdent("service", 0);
+
+    mStore.Init();
+
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(10, 1000, {instance})).IsNone());
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(30, 3000, {instance})).IsNone());
+
+    auto err = mStore.GetAverage(cNodeID, {}, *mAverage);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    EXPECT_EQ(mAverage->mNodeID, String(cNodeID));
+    EXPECT_DOUBLE_EQ(mAverage->mMonitoringData.mCPU, 20);
+    EXPECT_EQ(mAverage->mMonitoringData.mRAM, 2000);
+
+    ASSERT_EQ(mAverage->mMonitoringData.mPartitions.Size(), 1);
+    EXPECT_EQ(mAverage->mMonitoringData.mPartitions[0].mName, String("storage"));
+    EXPECT_EQ(mAverage->mMonitoringData.mPartitions[0].mUsedSize, 1000);
+
+    ASSERT_EQ(mAverage->mInstances.Size(), 1);
+    EXPECT_EQ(mAverage->mInstances[0].mInstanceIdent, instance);
+    EXPECT_EQ(mAverage->mInstances[0].mRuntimeID, String("runtime"));
+    EXPECT_DOUBLE_EQ(mAverage->mInstances[0].mMonitoringData.mCPU, 10);
+    EXPECT_EQ(mAverage->mInstances[0].mMonitoringData.mRAM, 1000);
+}
+
+TEST_F(MonitoringStoreTest, KeepLatestSamples)
+{
+    mStore.Init(2);
+
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(100, 100)).IsNone());
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(10, 100)).IsNone());
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(20, 100)).IsNone());
+
+    ASSERT_TRUE(mStore.GetAverage(cNodeID, {}, *mAverage).IsNone());
+
+    EXPECT_DOUBLE_EQ(mAverage->mMonitoringData.mCPU, 15);
+}
+
+TEST_F(MonitoringStoreTest, AverageWindow)
+{
+    mStore.Init();
+
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(100, 100)).IsNone());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(10, 100)).IsNone());
+
+    ASSERT_TRUE(mStore.GetAverage(cNodeID, Time::cMilliseconds * 100, *mAverage).IsNone());
+    EXPECT_DOUBLE_EQ(mAverage->mMonitoringData.mCPU, 10);
+
+    ASSERT_TRUE(mStore.GetAverage(cNodeID, Time::cSeconds * 10, *mAverage).IsNone());
+    EXPECT_DOUBLE_EQ(mAverage->mMonitoringData.mCPU, 55);
+}
+
+TEST_F(MonitoringStoreTest, GetPercentile)
+{
+    const auto instance = CreateInstanceIdent("service", 0);
+
+    mStore.Init();
+
+    for (auto cpu = 1; cpu <= 100; cpu++) {
+        ASSERT_TRUE(mStore.AddSample(*CreateSample(101 - cpu, 100, {instance})).IsNone());
+    }
+
+    auto [value, err] = mStore.GetPercentile(cNodeID, MonitoringParam::eCPU, 95, {});
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // Only the latest 64 samples (64..1) are kept.
+    EXPECT_DOUBLE_EQ(value, 61);
+
+    Tie(value, err) = mStore.GetPercentile(cNodeID, MonitoringParam::eCPU, 0, {});
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+    EXPECT_DOUBLE_EQ(value, 1);
+
+    Tie(value, err) = mStore.GetPercentile(cNodeID, instance, MonitoringParam::eCPU, 100, {});
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+    EXPECT_DOUBLE_EQ(value, 32);
+
+    EXPECT_TRUE(
+        mStore.GetPercentile(cNodeID, MonitoringParam::eCPU, 101, {}).mError.Is(ErrorEnum::eInvalidArgument));
+}
+
+TEST_F(MonitoringStoreTest, RemoveStoppedInstancesAndNodes)
+{
+    const auto instance0 = CreateInstanceIdent("service", 0);
+    const auto instance1 = CreateInstanceIdent("service", 1);
+
+    mStore.Init();
+
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(10, 100, {instance0, instance1})).IsNone());
+    ASSERT_TRUE(mStore.AddSample(*CreateSample(10, 100, {instance1})).IsNone());
+
+    ASSERT_TRUE(mStore.GetAverage(cNodeID, {}, *mAverage).IsNone());
+    ASSERT_EQ(mAverage->mInstances.Size(), 1);
+    EXPECT_EQ(mAverage->mInstances[0].mInstanceIdent, instance1);
+
+    EXPECT_TRUE(
+        mStore.GetPercentile(cNodeID, instance0, MonitoringParam::eCPU, 50, {}).mError.Is(ErrorEnum::eNotFound));
+
+    mStore.RemoveNode(cNodeID);
+
+    EXPECT_TRUE(mStore.GetAverage(cNodeID, {}, *mAverage).Is(ErrorEnum::eNotFound));
+}
+
+} // namespace aos::cm::smcontroller
@@ -258,6 +258,85 @@ TEST_F(SMControllerTest, GetNodeConfigStatus)
     EXPECT_TRUE(err.IsNone()) << err.Message();
 }
 
+TEST_F(SMControllerTest, GetNodeConfigStatusAfterLostResponse)
+{
+    // 1) Start client
+    SMClientStub client;
+
+    auto err = client.Init(cMainNodeID);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    err = client.Start(mConfig.mCMServerURL);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 2) Wait for SM info
+    err = mSMInfoReceiver.WaitSMInfo(cMainNodeID);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 3) First request is not answered
+    NodeConfigStatus status;
+
+    client.SkipNodeConfigStatusResponses(1);
+
+    err = mSMController.GetNodeConfigStatus(cMainNodeID, status);
+    EXPECT_TRUE(err.Is(ErrorEnum::eTimeout)) << err.Message();
+
+    // 4) Next request waits until the lost response expires and gets its own response
+    err = mSMController.GetNodeConfigStatus(cMainNodeID, status);
+    EXPECT_TRUE(err.IsNone()) << err.Message();
+
+    EXPECT_EQ(status.mVersion, String("1.0.0"));
+
+    // 5) Stop client
+    err = client.Stop();
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 6) Wait for disconnect
+    err = mSMInfoReceiver.WaitDisconnect(cMainNodeID);
+    EXPECT_TRUE(err.IsNone()) << err.Message();
+}
+
+TEST_F(SMControllerTest, GetNodeConfigStatusAfterLateResponse)
+{
+    // 1) Start client
+    SMClientStub client;
+
+    auto err = client.Init(cMainNodeID);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    err = client.Start(mConfig.mCMServerURL);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 2) Wait for SM info
+    err = mSMInfoReceiver.WaitSMInfo(cMainNodeID);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 3) First request is answered after timeout
+    NodeConfigStatus status;
+
+    client.HoldNodeConfigStatusResponses(1);
+
+    err = mSMController.GetNodeConfigStatus(cMainNodeID, status);
+    EXPECT_TRUE(err.Is(ErrorEnum::eTimeout)) << err.Message();
+
+    err = client.SendHeldNodeConfigStatusResponses("0.0.1");
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 4) Late response is dropped, next request gets its own response
+    err = mSMController.GetNodeConfigStatus(cMainNodeID, status);
+    EXPECT_TRUE(err.IsNone()) << err.Message();
+
+    EXPECT_EQ(status.mVersion, String("1.0.0"));
+
+    // 5) Stop client
+    err = client.Stop();
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 6) Wait for disconnect
+    err = mSMInfoReceiver.WaitDisconnect(cMainNodeID);
+    EXPECT_TRUE(err.IsNone()) << err.Message();
+}
+
 TEST_F(SMControllerTest, RequestLog)
 {
     // 1) Start client
@@ -673,6 +752,127 @@ TEST_F(SMControllerTest, InstantMonitoringReceived)
     EXPECT_EQ(instMonitoring.mMonitoringData.mCPU, 80);
     EXPECT_EQ(instMonitoring.mMonitoringData.mRAM, 1536);
 
+    // 5) Average monitoring is computed from received instant monitoring
+    aos::monitoring::NodeMonitoringData monitoring;
+
+    err = mSMController.GetAverageMonitoring(cMainNodeID, monitoring);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    EXPECT_EQ(monitoring.mMonitoringData.mCPU, 75);
+    EXPECT_EQ(monitoring.mMonitoringData.mRAM, 2048);
+    ASSERT_EQ(monitoring.mInstances.Size(), 1);
+    EXPECT_EQ(monitoring.mInstances[0].mInstanceIdent, instanceIdent);
+    EXPECT_EQ(monitoring.mInstances[0].mMonitoringData.mCPU, 80);
+
+    // 6) Stop client
+    err = client.Stop();
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 7) Wait for disconnect
+    err = mSMInfoReceiver.WaitDisconnect(cMainNodeID);
+    EXPECT_TRUE(err.IsNone()) << err.Message();
+}
+
+TEST_F(SMControllerTest, GetQueuesStats)
+{
+    // 1) Start client
+    SMClientStub client;
+
+    auto err = client.Init(cMainNodeID);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    err = client.Start(mConfig.mCMServerURL);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 2) Wait for SM info
+    err = mSMInfoReceiver.WaitSMInfo(cMainNodeID);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 3) Send instant monitoring
+    auto instanceIdent = CreateInstanceIdent("service1", "subject1", 0);
+
+    err = client.SendInstantMonitoring(instanceIdent);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    err = mMonitoringReceiver.WaitMonitoringData(cMainNodeID, instanceIdent);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 4) Check queues stats
+    SMHandler::QueuesStats stats;
+
+    err = mSMController.GetQueuesStats(cMainNodeID, stats);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    const auto& monitoringStats = stats[static_cast<size_t>(SMHandler::Lane::eMonitoring)];
+
+    EXPECT_EQ(monitoringStats.mDepth, 0);
+    EXPECT_EQ(monitoringStats.mMaxDepth, 1);
+    EXPECT_EQ(monitoringStats.mProcessed, 1);
+    EXPECT_EQ(monitoringStats.mBlocked, 0);
+    EXPECT_EQ(monitoringStats.mDropped, 0);
+
+    EXPECT_GE(stats[static_cast<size_t>(SMHandler::Lane::eStatus)].mProcessed, 1);
+    EXPECT_EQ(stats[static_cast<size_t>(SMHandler::Lane::eLog)].mProcessed, 0);
+
+    err = mSMController.GetQueuesStats(cSecondaryNodeID, stats);
+    EXPECT_TRUE(err.Is(ErrorEnum::eNotFound)) << err.Message();
+
+    // 5) Stop client
+    err = client.Stop();
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 6) Wait for disconnect
+    err = mSMInfoReceiver.WaitDisconnect(cMainNodeID);
+    EXPECT_TRUE(err.IsNone()) << err.Message();
+}
+
+TEST_F(SMControllerTest, FullLogLaneDoesNotBlockResponses)
+{
+    // 1) Start client
+    SMClientStub client;
+
+    auto err = client.Init(cMainNodeID);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    err = client.Start(mConfig.mCMServerURL);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 2) Wait for SM info
+    err = mSMInfoReceiver.WaitSMInfo(cMainNodeID);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    // 3) Overflow log lane while logs are not consumed
+    constexpr auto cNumLogs = 100;
+
+    mSMControllerSender.BlockLogs(true);
+
+    for (uint64_t part = 0; part < cNumLogs; ++part) {
+        servicemanager::v5::SMOutgoingMessages outMsg;
+
+        outMsg.mutable_log()->set_correlation_id("log-id");
+        outMsg.mutable_log()->set_part(part);
+
+        client.SendOutgoingMessage(outMsg);
+    }
+
+    // 4) Response sent after the logs is still received
+    NodeConfigStatus status;
+
+    err = mSMController.GetNodeConfigStatus(cMainNodeID, status);
+    EXPECT_TRUE(err.IsNone()) << err.Message();
+
+    mSMControllerSender.BlockLogs(false);
+
+    SMHandler::QueuesStats stats;
+
+    err = mSMController.GetQueuesStats(cMainNodeID, stats);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    const auto& logStats = stats[static_cast<size_t>(SMHandler::Lane::eLog)];
+
+    EXPECT_GT(logStats.mDropped, 0);
+    EXPECT_EQ(logStats.mBlocked, 0);
+
     // 5) Stop client
     err = client.Stop();
     ASSERT_TRUE(err.IsNone()) << err.Message();
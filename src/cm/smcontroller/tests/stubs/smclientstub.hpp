@@ -392,7 +392,53 @@ public:
         return ErrorEnum::eNone;
     }
 
+    void SkipNodeConfigStatusResponses(size_t count)
+    {
+        std::lock_guard lock {mMutex};
+
+        mSkipNodeConfigStatusResponses = count;
+    }
+
+    void HoldNodeConfigStatusResponses(size_t count)
+    {
+        std::lock_guard lock {mMutex};
+
+        mHoldNodeConfigStatusResponses = count;
+    }
+
+    Error SendHeldNodeConfigStatusResponses(const std::string& version)
+    {
+        std::lock_guard lock {mMutex};
+
+        for (; mNumHeldNodeConfigStatusResponses > 0; mNumHeldNodeConfigStatusResponses--) {
+            if (auto err = WriteNodeConfigStatus(version); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        return ErrorEnum::eNone;
+    }
+
 private:
+    Error WriteNodeConfigStatus(const std::string& version)
+    {
+        if (!mStream) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "stream not available"));
+        }
+
+        servicemanager::v5::SMOutgoingMessages outMsg;
+        auto*                                  status = outMsg.mutable_node_config_status();
+
+        status->set_version(version);
+        status->set_state("installed");
+
+        if (!mStream->Write(outMsg)) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "failed to write node config status"));
+        }
+
+        return ErrorEnum::eNone;
+    }
+
     Error SendSMInfo()
     {
         std::lock_guard lock {mMutex};
@@ -447,17 +493,20 @@ private:
 
     void ProcessGetNodeConfigStatus()
     {
-        if (!mStream) {
+        if (mSkipNodeConfigStatusResponses > 0) {
+            mSkipNodeConfigStatusResponses--;
+
             return;
         }
 
-        servicemanager::v5::SMOutgoingMessages outMsg;
-        auto*                                  status = outMsg.mutable_node_config_status();
+        if (mHoldNodeConfigStatusResponses > 0) {
+            mHoldNodeConfigStatusResponses--;
+            mNumHeldNodeConfigStatusResponses++;
 
-        status->set_version("1.0.0");
-        status->set_state("installed");
+            return;
+        }
 
-        mStream->Write(outMsg);
+        WriteNodeConfigStatus("1.0.0");
     }
 
     void ProcessSystemLogRequest(const servicemanager::v5::SystemLogRequest& request)
@@ -636,6 +685,9 @@ private:
     std::condition_variable                                mCloudConnectionCV;
     std::condition_variable                                mNetworkUpdateCV;
     std::vector<servicemanager::v5::PendingFirewallUpdate> mReceivedUpdates;
+    size_t                                                 mSkipNodeConfigStatusResponses {};
+    size_t                                                 mHoldNodeConfigStatusResponses {};
+    size_t                                                 mNumHeldNodeConfigStatusResponses {};
 };
 
 } // namespace aos::cm::smcontroller
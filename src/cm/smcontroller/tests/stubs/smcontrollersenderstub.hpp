@@ -24,7 +24,9 @@ class SenderStub : public SenderItf {
 public:
     Error SendLog(const PushLog& log) override
     {
-        std::lock_guard lock {mMutex};
+        std::unique_lock lock {mMutex};
+
+        mCV.wait(lock, [this]() { return !mBlockLogs; });
 
         mLogs.push_back(log);
         mCV.notify_one();
@@ -64,12 +66,21 @@ public:
         return it != mLogs.end();
     }
 
+    void BlockLogs(bool block)
+    {
+        std::lock_guard lock {mMutex};
+
+        mBlockLogs = block;
+        mCV.notify_all();
+    }
+
 private:
     static constexpr auto cDefaultTimeout = std::chrono::seconds(1);
 
     std::vector<PushLog>    mLogs;
     mutable std::mutex      mMutex;
     std::condition_variable mCV;
+    bool                    mBlockLogs {};
 };
 
 } // namespace aos::cm::smcontroller
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <common/cloudprotocol/desiredstatus.hpp>
+
+namespace aos::common::cloudprotocol {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cDesiredStatusJSON = R"({
+    "messageType": "desiredStatus",
+    "correlationId": "id",
+    "nodes": [
+        {
+            "item": {"codename": "node-1"},
+            "state": "provisioned"
+        },
+        {
+            "item": {"codename": "node-2"},
+            "state": "paused"
+        }
+    ],
+    "items": [
+        {
+            "item": {
+                "id": "item1",
+                "type": "service"
+            },
+            "version": "0.0.1",
+            "owner": {
+                "id": "owner1"
+            },
+            "indexDigest": "sha256:36f028580bb02cc8272a9a020f4200e346e276ae664e45ee80745574e2f5ab80"
+        },
+        {
+            "item": {
+                "id": "item2",
+                "type": "component"
+            },
+            "version": "1.2.3",
+            "owner": {
+                "id": "owner2"
+            },
+            "indexDigest": "sha256:abcdefabcdefabcdefabcdefabcdefabcdefabcdefabcdefabcdefabcdefabcd"
+        }
+    ],
+    "instances": [
+        {
+            "item": {
+                "id": "item1"
+            },
+            "subject": {
+                "id": "subject1"
+            },
+            "priority": 1,
+            "numInstances": 2,
+            "labels": [
+                "main"
+            ]
+        },
+        {
+            "item": {
+                "id": "item2"
+            },
+            "subject": {
+                "id": "subject2"
+            }
+        }
+    ]
+})";
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_DesiredStatusFromJSON(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto desiredStatus = std::make_unique<DesiredStatus>();
+
+        auto [json, err] = common::utils::ParseJson(cDesiredStatusJSON);
+        if (!err.IsNone()) {
+            state.SkipWithError("can't parse json");
+
+            break;
+        }
+
+        if (err = FromJSON(common::utils::CaseInsensitiveObjectWrapper(json), *desiredStatus); !err.IsNone()) {
+            state.SkipWithError("can't convert desired status from json");
+
+            break;
+        }
+    }
+}
+
+BENCHMARK(BM_DesiredStatusFromJSON);
+
+void BM_DesiredStatusToJSON(benchmark::State& state)
+{
+    auto desiredStatus = std::make_unique<DesiredStatus>();
+
+    auto [json, err] = common::utils::ParseJson(cDesiredStatusJSON);
+    if (!err.IsNone() || !FromJSON(common::utils::CaseInsensitiveObjectWrapper(json), *desiredStatus).IsNone()) {
+        state.SkipWithError("can't prepare desired status");
+
+        return;
+    }
+
+    std::string buffer;
+
+    for (auto _ : state) {
+        auto object = Poco::makeShared<Poco::JSON::Object>(Poco::JSON_PRESERVE_KEY_ORDER);
+
+        if (err = ToJSON(*desiredStatus, *object); !err.IsNone()) {
+            state.SkipWithError("can't convert desired status to json");
+
+            break;
+        }
+
+        buffer.clear();
+
+        common::utils::Stringify(object, buffer);
+
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+BENCHMARK(BM_DesiredStatusToJSON);
+
+} // namespace
+
+} // namespace aos::common::cloudprotocol
@@ -5,13 +5,12 @@
  */
 
 #include <filesystem>
-#include <fstream>
 #include <thread>
 
 #include <core/common/tools/logger.hpp>
 #include <core/common/types/alerts.hpp>
 
-#include <common/utils/exception.hpp>
+#include <common/utils/filesystem.hpp>
 
 #include "downloader.hpp"
 
@@ -210,16 +209,11 @@ Error Downloader::CopyFile(const Poco::URI& uri, const String& outfilename)
         return Error(ErrorEnum::eFailed, "file not found");
     }
 
-    try {
-        std::ifstream ifs(path, std::ios::binary);
-        std::ofstream ofs(outfilename.CStr(), std::ios::binary | std::ios::trunc);
-
-        ofs << ifs.rdbuf();
-
-        return ErrorEnum::eNone;
-    } catch (const std::exception& e) {
-        return AOS_ERROR_WRAP(utils::ToAosError(e));
+    if (auto err = utils::CopyFile(path, outfilename.CStr()); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
+
+    return ErrorEnum::eNone;
 }
 
 Error Downloader::RetryDownload(const String& url, const String& path, ProgressContext* context)
@@ -103,7 +103,7 @@ Error PublicCertService::SubscribeListener(const String& certType, aos::iamclien
         };
 
         manager = std::make_unique<CertSubscriptionManager>(mStub.get(), request,
-            &iamanager::v6::IAMPublicCertService::Stub::SubscribeCertChanged, convertFunc, notifyFunc,
+            &iamanager::v6::IAMPublicCertService::Stub::async::SubscribeCertChanged, convertFunc, notifyFunc,
             std::string("CertSubscription:") + certType.CStr());
     }
 
@@ -124,8 +124,8 @@ Error PublicCurrentNodeService::SubscribeListener(aos::iamclient::CurrentNodeInf
         };
 
         mSubscriptionManager = std::make_unique<CurrentNodeInfoSubscriptionManager>(mStub.get(), request,
-            &iamanager::v6::IAMPublicCurrentNodeService::Stub::SubscribeCurrentNodeChanged, convertFunc, notifyFunc,
-            "CurrentNodeSubscription");
+            &iamanager::v6::IAMPublicCurrentNodeService::Stub::async::SubscribeCurrentNodeChanged, convertFunc,
+            notifyFunc, "CurrentNodeSubscription");
     }
 
     return mSubscriptionManager->Subscribe(listener);
@@ -154,7 +154,7 @@ Error PublicIdentityService::SubscribeListener(aos::iamclient::SubjectsListenerI
         };
 
         mSubscriptionManager = std::make_unique<SubjectsSubscriptionManager>(mStub.get(), request,
-            &iamanager::v6::IAMPublicIdentityService::Stub::SubscribeSubjectsChanged, convertFunc, notifyFunc,
+            &iamanager::v6::IAMPublicIdentityService::Stub::async::SubscribeSubjectsChanged, convertFunc, notifyFunc,
             "SubjectsSubscription");
     }
 
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+
 #include <grpcpp/grpcpp.h>
 
 #include <core/common/tools/logger.hpp>
@@ -77,54 +79,73 @@ Error PublicNodesService::Reconnect()
 
 Error PublicNodesService::GetAllNodeIDs(Array<StaticString<cIDLen>>& ids) const
 {
-    std::lock_guard lock {mMutex};
+    auto                     cache = LoadCache();
+    std::vector<std::string> fetchedIDs;
+    const auto*              nodeIDs = &cache->mNodeIDs;
 
-    LOG_DBG() << "Get all node IDs";
+    if (cache->mLive && cache->mNodeIDsValid) {
+        mCacheHits++;
+    } else {
+        mCacheMisses++;
 
-    auto ctx = std::make_unique<grpc::ClientContext>();
-    ctx->set_deadline(std::chrono::system_clock::now() + cServiceTimeout);
+        {
+            std::lock_guard lock {mMutex};
 
-    google::protobuf::Empty request;
-    iamanager::v6::NodesID  response;
+            LOG_DBG() << "Get all node IDs";
 
-    if (auto status = mStub->GetAllNodeIDs(ctx.get(), request, &response); !status.ok()) {
-        return Error(ErrorEnum::eRuntime, status.error_message().c_str());
+            SubscribeCache();
+
+            if (auto err = FetchAllNodeIDs(fetchedIDs); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        CacheNodeIDs(cache->mGeneration, fetchedIDs);
+
+        nodeIDs = &fetchedIDs;
+
+        LOG_DBG() << "Node IDs received" << Log::Field("count", fetchedIDs.size());
     }
 
-    for (const auto& nodeID : response.ids()) {
+    for (const auto& nodeID : *nodeIDs) {
         if (auto err = ids.EmplaceBack(nodeID.c_str()); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
         }
     }
 
-    LOG_DBG() << "Node IDs received" << Log::Field("count", ids.Size());
-
     return ErrorEnum::eNone;
 }
 
 Error PublicNodesService::GetNodeInfo(const String& nodeID, NodeInfo& nodeInfo) const
 {
-    std::lock_guard lock {mMutex};
+    auto cache = LoadCache();
 
-    LOG_DBG() << "Get node info" << Log::Field("nodeID", nodeID);
+    if (cache->mLive) {
+        if (auto it = cache->mNodes.find(nodeID.CStr()); it != cache->mNodes.end()) {
+            mCacheHits++;
 
-    auto ctx = std::make_unique<grpc::ClientContext>();
-    ctx->set_deadline(std::chrono::system_clock::now() + cServiceTimeout);
+            nodeInfo = *it->second;
 
-    iamanager::v6::GetNodeInfoRequest request;
-    iamanager::v6::NodeInfo           response;
+            return ErrorEnum::eNone;
+        }
+    }
 
-    request.set_node_id(nodeID.CStr());
+    mCacheMisses++;
 
-    if (auto status = mStub->GetNodeInfo(ctx.get(), request, &response); !status.ok()) {
-        return Error(ErrorEnum::eRuntime, status.error_message().c_str());
-    }
+    {
+        std::lock_guard lock {mMutex};
 
-    auto err = pbconvert::ConvertToAos(response, nodeInfo);
-    if (!err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
+        LOG_DBG() << "Get node info" << Log::Field("nodeID", nodeID);
+
+        SubscribeCache();
+
+        if (auto err = FetchNodeInfo(nodeID, nodeInfo); !err.IsNone()) {
+            return err;
+        }
     }
 
+    CacheNodeInfo(cache->mGeneration, nodeInfo);
+
     LOG_DBG() << "Node info received" << Log::Field("nodeID", nodeInfo.mNodeID)
               << Log::Field("nodeType", nodeInfo.mNodeType);
 
@@ -137,23 +158,28 @@ Error PublicNodesService::SubscribeListener(aos::iamclient::NodeInfoListenerItf&
 
     LOG_DBG() << "Subscribe to node info changed";
 
-    if (!mSubscriptionManager) {
-        google::protobuf::Empty request;
+    CreateSubscriptionManager();
 
-        auto convertFunc = [](const iamanager::v6::NodeInfo& proto, NodeInfo& aos) -> Error {
-            return pbconvert::ConvertToAos(proto, aos);
-        };
+    return mSubscriptionManager->Subscribe(listener);
+}
 
-        auto notifyFunc = [](aos::iamclient::NodeInfoListenerItf& listener, const NodeInfo& nodeInfo) {
-            listener.OnNodeInfoChanged(nodeInfo);
-        };
+uint64_t PublicNodesService::GetCacheGeneration() const
+{
+    return LoadCache()->mGeneration;
+}
 
-        mSubscriptionManager = std::make_unique<NodeInfoSubscriptionManager>(mStub.get(), request,
-            &iamanager::v6::IAMPublicNodesService::Stub::SubscribeNodeChanged, convertFunc, notifyFunc,
-            "NodeSubscription");
-    }
+NodeInfoCacheStats PublicNodesService::GetCacheStats() const
+{
+    auto cache = LoadCache();
 
-    return mSubscriptionManager->Subscribe(listener);
+    return NodeInfoCacheStats {cache->mGeneration, mCacheHits.load(), mCacheMisses.load(), cache->mLive};
+}
+
+void PublicNodesService::InvalidateCache()
+{
+    LOG_DBG() << "Invalidate node info cache";
+
+    ResetCache(LoadCache()->mLive);
 }
 
 Error PublicNodesService::UnsubscribeListener(aos::iamclient::NodeInfoListenerItf& listener)
@@ -404,6 +430,151 @@ Error PublicNodesService::RebuildStub()
     return ErrorEnum::eNone;
 }
 
+void PublicNodesService::CreateSubscriptionManager() const
+{
+    if (mSubscriptionManager) {
+        return;
+    }
+
+    google::protobuf::Empty request;
+
+    auto convertFunc = [](const iamanager::v6::NodeInfo& proto, NodeInfo& aos) -> Error {
+        return pbconvert::ConvertToAos(proto, aos);
+    };
+
+    auto notifyFunc = [](aos::iamclient::NodeInfoListenerItf& listener, const NodeInfo& nodeInfo) {
+        listener.OnNodeInfoChanged(nodeInfo);
+    };
+
+    mSubscriptionManager = std::make_unique<NodeInfoSubscriptionManager>(mStub.get(), request,
+        &iamanager::v6::IAMPublicNodesService::Stub::async::SubscribeNodeChanged, convertFunc, notifyFunc,
+        "NodeSubscription");
+
+    // Notifications may be lost while the stream is down, so the cache is dropped on every stream state change. It
+    // becomes live only when IAM confirms the stream (initial metadata or first notification), not at call start.
+    mSubscriptionManager->SetStateHandler([this](bool connected) { ResetCache(connected); });
+}
+
+void PublicNodesService::SubscribeCache() const
+{
+    if (mCacheSubscribed) {
+        return;
+    }
+
+    CreateSubscriptionManager();
+
+    if (auto err = mSubscriptionManager->Subscribe(mCacheUpdater); !err.IsNone()) {
+        LOG_ERR() << "Failed to subscribe node info cache" << Log::Field(err);
+
+        return;
+    }
+
+    mCacheSubscribed = true;
+}
+
+void PublicNodesService::UpdateCache(const NodeInfo& nodeInfo) const
+{
+    std::lock_guard lock {mCacheMutex};
+
+    auto        cache = std::make_shared<NodeInfoCache>(*LoadCache());
+    std::string nodeID {nodeInfo.mNodeID.CStr()};
+
+    if (cache->mNodeIDsValid
+        && std::find(cache->mNodeIDs.begin(), cache->mNodeIDs.end(), nodeID) == cache->mNodeIDs.end()) {
+        cache->mNodeIDs.push_back(nodeID);
+    }
+
+    cache->mNodes[nodeID] = std::make_shared<const NodeInfo>(nodeInfo);
+    cache->mGeneration++;
+
+    std::atomic_store(&mCache, std::shared_ptr<const NodeInfoCache>(std::move(cache)));
+}
+
+void PublicNodesService::ResetCache(bool live) const
+{
+    std::lock_guard lock {mCacheMutex};
+
+    auto cache = std::make_shared<NodeInfoCache>();
+
+    cache->mGeneration = LoadCache()->mGeneration + 1;
+    cache->mLive       = live;
+
+    std::atomic_store(&mCache, std::shared_ptr<const NodeInfoCache>(std::move(cache)));
+}
+
+void PublicNodesService::CacheNodeIDs(uint64_t generation, const std::vector<std::string>& ids) const
+{
+    std::lock_guard lock {mCacheMutex};
+
+    auto current = LoadCache();
+
+    if (!current->mLive || current->mGeneration != generation) {
+        return;
+    }
+
+    auto cache = std::make_shared<NodeInfoCache>(*current);
+
+    cache->mNodeIDs      = ids;
+    cache->mNodeIDsValid = true;
+
+    std::atomic_store(&mCache, std::shared_ptr<const NodeInfoCache>(std::move(cache)));
+}
+
+void PublicNodesService::CacheNodeInfo(uint64_t generation, const NodeInfo& nodeInfo) const
+{
+    std::lock_guard lock {mCacheMutex};
+
+    auto current = LoadCache();
+
+    if (!current->mLive || current->mGeneration != generation) {
+        return;
+    }
+
+    auto cache = std::make_shared<NodeInfoCache>(*current);
+
+    cache->mNodes[nodeInfo.mNodeID.CStr()] = std::make_shared<const NodeInfo>(nodeInfo);
+
+    std::atomic_store(&mCache, std::shared_ptr<const NodeInfoCache>(std::move(cache)));
+}
+
+Error PublicNodesService::FetchAllNodeIDs(std::vector<std::string>& ids) const
+{
+    auto ctx = std::make_unique<grpc::ClientContext>();
+    ctx->set_deadline(std::chrono::system_clock::now() + cServiceTimeout);
+
+    google::protobuf::Empty request;
+    iamanager::v6::NodesID  response;
+
+    if (auto status = mStub->GetAllNodeIDs(ctx.get(), request, &response); !status.ok()) {
+        return Error(ErrorEnum::eRuntime, status.error_message().c_str());
+    }
+
+    ids.assign(response.ids().begin(), response.ids().end());
+
+    return ErrorEnum::eNone;
+}
+
+Error PublicNodesService::FetchNodeInfo(const String& nodeID, NodeInfo& nodeInfo) const
+{
+    auto ctx = std::make_unique<grpc::ClientContext>();
+    ctx->set_deadline(std::chrono::system_clock::now() + cServiceTimeout);
+
+    iamanager::v6::GetNodeInfoRequest request;
+    iamanager::v6::NodeInfo           response;
+
+    request.set_node_id(nodeID.CStr());
+
+    if (auto status = mStub->GetNodeInfo(ctx.get(), request, &response); !status.ok()) {
+        return Error(ErrorEnum::eRuntime, status.error_message().c_str());
+    }
+
+    if (auto err = pbconvert::ConvertToAos(response, nodeInfo); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
 void PublicNodesService::AdvanceCredential()
 {
     if (mCredentials.size() <= 1) {
@@ -14,6 +14,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <grpcpp/grpcpp.h>
@@ -31,8 +32,21 @@ namespace aos::common::iamclient {
 using NodeInfoSubscriptionManager = utils::GRPCSubscriptionManager<iamanager::v6::IAMPublicNodesService::Stub,
     aos::iamclient::NodeInfoListenerItf, iamanager::v6::NodeInfo, NodeInfo, google::protobuf::Empty>;
 
+/**
+ * Node info cache statistics.
+ */
+struct NodeInfoCacheStats {
+    uint64_t mGeneration {};
+    uint64_t mHits {};
+    uint64_t mMisses {};
+    bool     mLive {};
+};
+
 /**
  * Public nodes service.
+ *
+ * Node info lookups are served from a local cache which is kept current by the node info subscription stream. The
+ * cache is used only while the subscription stream is confirmed by IAM, otherwise lookups go to IAM directly.
  */
 class PublicNodesService : public aos::iamclient::NodeInfoProviderItf {
 public:
@@ -86,6 +100,27 @@ public:
      */
     Error UnsubscribeListener(aos::iamclient::NodeInfoListenerItf& listener) override;
 
+    /**
+     * Returns node info cache generation.
+     * Generation changes whenever cached node info may have changed: on node info notifications, on invalidation and
+     * on subscription stream reconnection.
+     *
+     * @return uint64_t.
+     */
+    uint64_t GetCacheGeneration() const;
+
+    /**
+     * Returns node info cache statistics.
+     *
+     * @return NodeInfoCacheStats.
+     */
+    NodeInfoCacheStats GetCacheStats() const;
+
+    /**
+     * Drops all cached node info.
+     */
+    void InvalidateCache();
+
     /**
      * Reconnects to the server.
      * Note: Active subscription will be reconnected automatically.
@@ -120,6 +155,27 @@ protected:
     virtual void  OnDisconnected();
 
 private:
+    struct NodeInfoCache {
+        uint64_t                                                         mGeneration {};
+        bool                                                             mLive {};
+        bool                                                             mNodeIDsValid {};
+        std::vector<std::string>                                         mNodeIDs;
+        std::unordered_map<std::string, std::shared_ptr<const NodeInfo>> mNodes;
+    };
+
+    class CacheUpdater : public aos::iamclient::NodeInfoListenerItf {
+    public:
+        explicit CacheUpdater(PublicNodesService& service)
+            : mService(service)
+        {
+        }
+
+        void OnNodeInfoChanged(const NodeInfo& nodeInfo) override { mService.UpdateCache(nodeInfo); }
+
+    private:
+        PublicNodesService& mService;
+    };
+
     static constexpr auto cServiceTimeout    = std::chrono::seconds(10);
     static constexpr auto cReconnectInterval = std::chrono::seconds(3);
     static constexpr auto cConnectTimeout    = std::chrono::seconds(3);
@@ -130,6 +186,16 @@ private:
     Error CreateCredentials();
     Error RebuildStub();
     void  AdvanceCredential();
+    void  CreateSubscriptionManager() const;
+    void  SubscribeCache() const;
+    void  UpdateCache(const NodeInfo& nodeInfo) const;
+    void  ResetCache(bool live) const;
+    void  CacheNodeIDs(uint64_t generation, const std::vector<std::string>& ids) const;
+    void  CacheNodeInfo(uint64_t generation, const NodeInfo& nodeInfo) const;
+    Error FetchAllNodeIDs(std::vector<std::string>& ids) const;
+    Error FetchNodeInfo(const String& nodeID, NodeInfo& nodeInfo) const;
+
+    std::shared_ptr<const NodeInfoCache> LoadCache() const { return std::atomic_load(&mCache); }
 
     std::string                                                 mIAMPublicServerURL;
     bool                                                        mInsecureConnection {false};
@@ -140,7 +206,14 @@ private:
     std::unique_ptr<iamanager::v6::IAMPublicNodesService::Stub> mStub;
     TLSCredentialsItf*                                          mTLSCredentials {};
     mutable std::mutex                                          mMutex;
-    std::unique_ptr<NodeInfoSubscriptionManager>                mSubscriptionManager;
+    mutable std::unique_ptr<NodeInfoSubscriptionManager>        mSubscriptionManager;
+
+    mutable CacheUpdater                         mCacheUpdater {*this};
+    mutable bool                                 mCacheSubscribed {false};
+    mutable std::mutex                           mCacheMutex;
+    mutable std::shared_ptr<const NodeInfoCache> mCache {std::make_shared<NodeInfoCache>()};
+    mutable std::atomic<uint64_t>                mCacheHits {0};
+    mutable std::atomic<uint64_t>                mCacheMisses {0};
 
     std::unique_ptr<grpc::ClientContext> mRegisterNodeCtx;
     std::unique_ptr<
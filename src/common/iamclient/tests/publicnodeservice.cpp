@@ -89,6 +89,91 @@ TEST_F(PublicNodesServiceTest, GetNodeInfo)
     EXPECT_STREQ(nodeInfo.mNodeType.CStr(), "secondary");
 }
 
+TEST_F(PublicNodesServiceTest, CacheIsNotLiveUntilStreamConfirmed)
+{
+    mStub->SetNodeIds({"node1"});
+    mStub->SetNodeInfo("node1", "main");
+    mStub->SetConfirmSubscription(false);
+
+    aos::NodeInfo nodeInfo;
+
+    // Stream is opened but not confirmed by IAM: cache stays off
+
+    ASSERT_EQ(mService->GetNodeInfo("node1", nodeInfo), aos::ErrorEnum::eNone);
+    ASSERT_TRUE(mStub->WaitForConnection());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_FALSE(mService->GetCacheStats().mLive);
+
+    // First notification confirms the stream
+
+    ASSERT_TRUE(mStub->SendNodeInfoChanged("node1", "secondary"));
+
+    bool live = false;
+
+    for (int i = 0; i < 100 && !live; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        live = mService->GetCacheStats().mLive;
+    }
+
+    EXPECT_TRUE(live);
+}
+
+TEST_F(PublicNodesServiceTest, GetNodeInfoFromCache)
+{
+    mStub->SetNodeIds({"node1"});
+    mStub->SetNodeInfo("node1", "main");
+
+    auto waitCache = [this](std::function<bool(const NodeInfoCacheStats&)> condition) {
+        for (int i = 0; i < 100; i++) {
+            if (condition(mService->GetCacheStats())) {
+                return true;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        return false;
+    };
+
+    aos::NodeInfo nodeInfo;
+
+    // First lookup goes to IAM and starts the cache subscription
+
+    ASSERT_EQ(mService->GetNodeInfo("node1", nodeInfo), aos::ErrorEnum::eNone);
+    ASSERT_TRUE(mStub->WaitForConnection());
+    ASSERT_TRUE(waitCache([](const NodeInfoCacheStats& stats) { return stats.mLive; }));
+
+    // Lookup on live cache primes it, next one is a hit
+
+    ASSERT_EQ(mService->GetNodeInfo("node1", nodeInfo), aos::ErrorEnum::eNone);
+
+    auto stats = mService->GetCacheStats();
+
+    ASSERT_EQ(mService->GetNodeInfo("node1", nodeInfo), aos::ErrorEnum::eNone);
+    EXPECT_STREQ(nodeInfo.mNodeType.CStr(), "main");
+    EXPECT_EQ(mService->GetCacheStats().mHits, stats.mHits + 1);
+    EXPECT_EQ(mService->GetCacheStats().mMisses, stats.mMisses);
+
+    // Cache is updated by subscription notification
+
+    ASSERT_TRUE(mStub->SendNodeInfoChanged("node1", "secondary"));
+    ASSERT_TRUE(waitCache(
+        [&stats](const NodeInfoCacheStats& current) { return current.mGeneration != stats.mGeneration; }));
+
+    ASSERT_EQ(mService->GetNodeInfo("node1", nodeInfo), aos::ErrorEnum::eNone);
+    EXPECT_STREQ(nodeInfo.mNodeType.CStr(), "secondary");
+
+    // Invalidated cache goes to IAM again
+
+    mService->InvalidateCache();
+
+    ASSERT_EQ(mService->GetNodeInfo("node1", nodeInfo), aos::ErrorEnum::eNone);
+    EXPECT_STREQ(nodeInfo.mNodeType.CStr(), "main");
+}
+
 TEST_F(PublicNodesServiceTest, SubscribeNodeChanged)
 {
     NodesListenerMock listener;
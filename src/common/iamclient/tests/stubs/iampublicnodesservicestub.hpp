@@ -60,6 +60,13 @@ public:
         mNodeInfos[nodeID] = nodeType;
     }
 
+    void SetConfirmSubscription(bool confirm)
+    {
+        std::lock_guard lock {mMutex};
+
+        mConfirmSubscription = confirm;
+    }
+
     bool SendNodeInfoChanged(const std::string& nodeID, const std::string& nodeType)
     {
         std::lock_guard lock {mMutex};
@@ -160,6 +167,10 @@ public:
         {
             std::lock_guard lock {mMutex};
 
+            if (mConfirmSubscription) {
+                writer->SendInitialMetadata();
+            }
+
             mWriter = writer;
             mCV.notify_all();
         }
@@ -213,6 +224,7 @@ private:
     mutable std::mutex                           mMutex;
     std::condition_variable                      mCV;
     grpc::ServerWriter<iamanager::v6::NodeInfo>* mWriter {nullptr};
+    bool                                         mConfirmSubscription {true};
     std::vector<std::string>                     mNodeIds;
     std::map<std::string, std::string>           mNodeInfos;
 
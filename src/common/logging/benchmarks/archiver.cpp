@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstring>
+
+#include <benchmark/benchmark.h>
+
+#include <common/logging/archiver.hpp>
+
+namespace aos::common::logging {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cLogID   = "BenchmarkLogID";
+constexpr auto cMessage = "2025-01-01T00:00:00Z aos_servicemanager[1234]: instance started instanceID=item1:subject1:0";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+/**
+ * Log sender stub.
+ */
+class LogSenderStub : public aos::logging::SenderItf {
+public:
+    Error SendLog(const PushLog& log) override
+    {
+        benchmark::DoNotOptimize(log.mContent.Size());
+
+        return ErrorEnum::eNone;
+    }
+};
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_ArchiveLog(benchmark::State& state)
+{
+    const auto numMessages = state.range(0);
+
+    LogSenderStub              logSender;
+    const aos::logging::Config config {64 * 1024, 100};
+
+    for (auto _ : state) {
+        Archiver archiver(logSender, config);
+
+        for (int64_t i = 0; i < numMessages; i++) {
+            archiver.AddLog(cMessage);
+        }
+
+        if (auto err = archiver.SendLog(cLogID); !err.IsNone()) {
+            state.SkipWithError("can't send log");
+
+            break;
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * numMessages * strlen(cMessage));
+}
+
+BENCHMARK(BM_ArchiveLog)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+
+} // namespace aos::common::logging
@@ -16,6 +16,7 @@
 #include <net/if.h>
 
 #include <linux/if.h>
+#include <linux/netlink.h>
 #include <linux/rtnetlink.h>
 #include <netinet/in.h>
 #include <netlink/errno.h>
@@ -28,6 +29,7 @@
 #include <netlink/route/nexthop.h>
 #include <netlink/route/route.h>
 #include <sched.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
 #include <core/common/tools/logger.hpp>
@@ -76,6 +78,199 @@ Error WithNetNS(const std::string& netNSPath, const std::function<Error()>& fn)
     return fn();
 }
 
+// Resolves the ifindex via if_nametoindex (ioctl) instead of dumping the whole link table. The ioctl socket is created
+// in the calling thread's current netns, so it also works inside WithNetNS.
+RetWithError<int> GetLinkIndex(const String& ifname)
+{
+    unsigned int ifindex = if_nametoindex(ifname.CStr());
+    if (ifindex == 0) {
+        const auto message = "interface not found: " + std::string(ifname.CStr());
+
+        return {0, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, message.c_str()))};
+    }
+
+    return static_cast<int>(ifindex);
+}
+
+Error SetLinkUp(nl_sock* sock, const String& ifname)
+{
+    auto link = DeferRelease(rtnl_link_alloc(), rtnl_link_put);
+    if (!link) {
+        return NLToAosErr(errno, "failed to allocate link object");
+    }
+
+    rtnl_link_set_name(link.Get(), ifname.CStr());
+    rtnl_link_set_flags(link.Get(), IFF_UP);
+
+    if (auto errLinkChange = rtnl_link_change(sock, link.Get(), link.Get(), 0); errLinkChange < 0) {
+        return NLToAosErr(errLinkChange, "failed to set link up");
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error AddLinkAddr(nl_sock* sock, const String& ifname, const IPAddr& addr)
+{
+    auto addrObj = DeferRelease(rtnl_addr_alloc(), rtnl_addr_put);
+    if (!addrObj) {
+        return NLToAosErr(errno, "failed to allocate address object");
+    }
+
+    auto [ifindex, err] = GetLinkIndex(ifname);
+    if (!err.IsNone()) {
+        return err;
+    }
+
+    rtnl_addr_set_ifindex(addrObj.Get(), ifindex);
+
+    struct nl_addr* local;
+
+    if (auto errLocal = nl_addr_parse(addr.mIP.c_str(), addr.mFamily, &local); errLocal < 0) {
+        return NLToAosErr(errLocal, ("failed to parse IP address " + std::string(addr.mIP)));
+    }
+
+    [[maybe_unused]] auto cleanupLocal = DeferRelease(local, [](nl_addr* addr) { nl_addr_put(addr); });
+
+    rtnl_addr_set_local(addrObj.Get(), local);
+
+    if (!addr.mSubnet.empty()) {
+        struct nl_addr* subnet;
+
+        if (auto errSubnet = nl_addr_parse(addr.mSubnet.c_str(), addr.mFamily, &subnet); errSubnet < 0) {
+            return NLToAosErr(errSubnet, ("failed to parse subnet CIDR " + std::string(addr.mSubnet)));
+        }
+
+        [[maybe_unused]] auto cleanupSubnet = DeferRelease(subnet, [](nl_addr* addr) { nl_addr_put(addr); });
+        int                   prefixlen     = nl_addr_get_prefixlen(subnet);
+
+        rtnl_addr_set_prefixlen(addrObj.Get(), prefixlen);
+
+        struct in_addr ipAddr, netmask, broadcast;
+        inet_pton(AF_INET, addr.mIP.c_str(), &ipAddr);
+
+        netmask.s_addr = htonl(~((1UL << (32 - prefixlen)) - 1));
+
+        // Calculate broadcast: broadcast = ip | ~netmask
+        broadcast.s_addr = (ipAddr.s_addr & netmask.s_addr) | ~netmask.s_addr;
+
+        char brdStr[INET_ADDRSTRLEN];
+
+        inet_ntop(AF_INET, &broadcast, brdStr, INET_ADDRSTRLEN);
+
+        struct nl_addr* brd;
+
+        if (nl_addr_parse(brdStr, addr.mFamily, &brd) >= 0) {
+            [[maybe_unused]] auto cleanupBrd = DeferRelease(brd, [](nl_addr* addr) { nl_addr_put(addr); });
+            rtnl_addr_set_broadcast(addrObj.Get(), brd);
+        }
+    }
+
+    if (!addr.mLabel.empty()) {
+        rtnl_addr_set_label(addrObj.Get(), addr.mLabel.c_str());
+    }
+
+    if (auto errAddrAdd = rtnl_addr_add(sock, addrObj.Get(), 0); errAddrAdd < 0 && errAddrAdd != -NLE_EXIST) {
+        return NLToAosErr(errAddrAdd, "failed to add address");
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error AddGatewayRoute(nl_sock* sock, const String& destination, const String& gateway)
+{
+    auto route = DeferRelease(rtnl_route_alloc(), rtnl_route_put);
+    if (!route) {
+        return NLToAosErr(errno, "failed to allocate route");
+    }
+
+    rtnl_route_set_scope(route.Get(), RT_SCOPE_UNIVERSE);
+    rtnl_route_set_table(route.Get(), RT_TABLE_MAIN);
+    rtnl_route_set_protocol(route.Get(), RTPROT_STATIC);
+
+    struct nl_addr* dst = nullptr;
+
+    if (nl_addr_parse(destination.CStr(), AF_INET, &dst) < 0) {
+        return AOS_ERROR_WRAP(
+            Error(ErrorEnum::eFailed, ("failed to parse destination: " + std::string(destination.CStr())).c_str()));
+    }
+
+    [[maybe_unused]] auto cleanupDst = DeferRelease(dst, [](nl_addr* a) { nl_addr_put(a); });
+
+    rtnl_route_set_dst(route.Get(), dst);
+
+    auto* nh = rtnl_route_nh_alloc();
+    if (!nh) {
+        return NLToAosErr(errno, "failed to allocate nexthop");
+    }
+
+    struct nl_addr* gw = nullptr;
+
+    if (nl_addr_parse(gateway.CStr(), AF_INET, &gw) < 0) {
+        rtnl_route_nh_free(nh);
+
+        return AOS_ERROR_WRAP(
+            Error(ErrorEnum::eFailed, ("failed to parse gateway: " + std::string(gateway.CStr())).c_str()));
+    }
+
+    [[maybe_unused]] auto cleanupGw = DeferRelease(gw, [](nl_addr* a) { nl_addr_put(a); });
+
+    rtnl_route_nh_set_gateway(nh, gw);
+    rtnl_route_add_nexthop(route.Get(), nh);
+    // rtnl_route_add_nexthop takes ownership of nh — no separate free.
+
+    if (auto errAdd = rtnl_route_add(sock, route.Get(), NLM_F_CREATE); errAdd < 0) {
+        return NLToAosErr(errAdd, "failed to add route");
+    }
+
+    return ErrorEnum::eNone;
+}
+
+struct AddrListContext {
+    int            mIfindex;
+    int            mFamily;
+    Array<IPAddr>* mAddresses;
+    Error          mErr;
+};
+
+void AppendAddr(nl_object* obj, void* arg)
+{
+    auto* ctx  = static_cast<AddrListContext*>(arg);
+    auto* addr = reinterpret_cast<rtnl_addr*>(obj);
+
+    // Kernels without strict checking ignore the request filter and return all addresses.
+    if (!ctx->mErr.IsNone() || rtnl_addr_get_ifindex(addr) != ctx->mIfindex
+        || (ctx->mFamily != AF_UNSPEC && rtnl_addr_get_family(addr) != ctx->mFamily)) {
+        return;
+    }
+
+    IPAddr ipAddr;
+    ipAddr.mFamily = rtnl_addr_get_family(addr);
+
+    if (const auto* local = rtnl_addr_get_local(addr); local) {
+        char buf[INET6_ADDRSTRLEN];
+
+        nl_addr2str(local, buf, sizeof(buf));
+        ipAddr.mIP = buf;
+    }
+
+    if (const char* label = rtnl_addr_get_label(addr); label) {
+        ipAddr.mLabel = label;
+    }
+
+    if (auto err = ctx->mAddresses->PushBack(ipAddr); !err.IsNone()) {
+        ctx->mErr = AOS_ERROR_WRAP(err);
+    }
+}
+
+int HandleAddrMsg(nl_msg* msg, void* arg)
+{
+    if (auto ret = nl_msg_parse(msg, AppendAddr, arg); ret < 0) {
+        static_cast<AddrListContext*>(arg)->mErr = NLToAosErr(ret, "failed to parse address");
+    }
+
+    return NL_OK;
+}
+
 RetWithError<std::string> GenerateMACAddress(crypto::RandomItf& random)
 {
     StaticArray<uint8_t, 6> mac;
@@ -164,19 +359,19 @@ Error InterfaceManager::GetLink(const String& ifname, sm::networkmanager::LinkIn
         return err;
     }
 
-    nl_cache* cacheRaw;
-
-    if (auto ret = rtnl_link_alloc_cache(sock.get(), AF_UNSPEC, &cacheRaw); ret < 0) {
-        return NLToAosErr(ret, "failed to allocate link cache");
-    }
+    rtnl_link* linkRaw = nullptr;
 
-    [[maybe_unused]] auto cleanupCache = DeferRelease(cacheRaw, [](nl_cache* cache) { nl_cache_free(cache); });
+    // Request the single link from the kernel instead of dumping the whole link table.
+    if (auto ret = rtnl_link_get_kernel(sock.get(), 0, ifname.CStr(), &linkRaw); ret < 0) {
+        if (ret == -NLE_OBJ_NOTFOUND || ret == -NLE_NODEV) {
+            return Error(ErrorEnum::eNotFound, "link not found");
+        }
 
-    auto link = DeferRelease(rtnl_link_get_by_name(cacheRaw, ifname.CStr()), rtnl_link_put);
-    if (!link) {
-        return Error(ErrorEnum::eNotFound, "link not found");
+        return NLToAosErr(ret, "failed to get link");
     }
 
+    auto link = DeferRelease(linkRaw, rtnl_link_put);
+
     if (err = info.mName.Assign(ifname); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
@@ -194,7 +389,7 @@ Error InterfaceManager::GetLink(const String& ifname, sm::networkmanager::LinkIn
     if (const auto masterIndex = rtnl_link_get_master(link.Get()); masterIndex > 0) {
         char masterName[IFNAMSIZ] = {};
 
-        if (rtnl_link_i2name(cacheRaw, masterIndex, masterName, sizeof(masterName)) != nullptr) {
+        if (if_indextoname(static_cast<unsigned int>(masterIndex), masterName) != nullptr) {
             if (err = info.mMaster.Assign(masterName); !err.IsNone()) {
                 return AOS_ERROR_WRAP(err);
             }
@@ -251,19 +446,7 @@ Error InterfaceManager::SetupLink(const String& ifname, const String& netNSPath)
             return err;
         }
 
-        auto [link, linkErr] = AllocLink();
-        if (!linkErr.IsNone()) {
-            return linkErr;
-        }
-
-        rtnl_link_set_name(link.get(), ifname.CStr());
-        rtnl_link_set_flags(link.get(), IFF_UP);
-
-        if (auto errLinkChange = rtnl_link_change(sock.get(), link.get(), link.get(), 0); errLinkChange < 0) {
-            return NLToAosErr(errLinkChange, "failed to set link up");
-        }
-
-        return ErrorEnum::eNone;
+        return SetLinkUp(sock.get(), ifname);
     };
 
     if (netNSPath.IsEmpty()) {
@@ -342,54 +525,46 @@ Error InterfaceManager::GetAddrList(const String& ifname, int family, Array<IPAd
 {
     LOG_DBG() << "List addresses for interface: ifname=" << ifname;
 
-    auto [sock, err] = CreateNetlinkSocket();
+    auto [ifindex, err] = GetLinkIndex(ifname);
     if (!err.IsNone()) {
         return err;
     }
 
-    nl_cache* cacheRaw;
-
-    if (auto errAddrCache = rtnl_addr_alloc_cache(sock.get(), &cacheRaw); errAddrCache < 0) {
-        return NLToAosErr(errAddrCache, "failed to allocate address cache");
+    auto [sock, sockErr] = CreateNetlinkSocket();
+    if (!sockErr.IsNone()) {
+        return sockErr;
     }
 
-    [[maybe_unused]] auto cleanupCache = DeferRelease(cacheRaw, [](nl_cache* cache) { nl_cache_free(cache); });
+#ifdef NETLINK_GET_STRICT_CHK
+    // With strict checking the kernel dumps only addresses of the requested interface instead of the whole table.
+    int strictCheck = 1;
 
-    auto [link, linkErr] = AllocLink();
-    if (!linkErr.IsNone()) {
-        return linkErr;
+    if (setsockopt(nl_socket_get_fd(sock.get()), SOL_NETLINK, NETLINK_GET_STRICT_CHK, &strictCheck, sizeof(strictCheck))
+        != 0) {
+        LOG_DBG() << "Netlink strict checking not supported: err=" << strerror(errno);
     }
+#endif
 
-    rtnl_link_set_name(link.get(), ifname.CStr());
-
-    for (auto obj = nl_cache_get_first(cacheRaw); obj != nullptr; obj = nl_cache_get_next(obj)) {
-        auto addr = reinterpret_cast<struct rtnl_addr*>(obj);
-
-        if (rtnl_addr_get_ifindex(addr) == rtnl_link_get_ifindex(link.get())
-            && (family == AF_UNSPEC || rtnl_addr_get_family(addr) == family)) {
+    struct ifaddrmsg request {};
 
-            IPAddr ipAddr;
-            ipAddr.mFamily = rtnl_addr_get_family(addr);
+    request.ifa_family = family;
+    request.ifa_index  = ifindex;
 
-            if (const auto* local = rtnl_addr_get_local(addr); local) {
-                char buf[INET6_ADDRSTRLEN];
+    if (auto ret = nl_send_simple(sock.get(), RTM_GETADDR, NLM_F_DUMP, &request, sizeof(request)); ret < 0) {
+        return NLToAosErr(ret, "failed to request addresses");
+    }
 
-                nl_addr2str(local, buf, sizeof(buf));
-                ipAddr.mIP = buf;
-            }
+    AddrListContext ctx {ifindex, family, &addresses, ErrorEnum::eNone};
 
-            const char* label = rtnl_addr_get_label(addr);
-            if (label) {
-                ipAddr.mLabel = label;
-            }
+    if (auto ret = nl_socket_modify_cb(sock.get(), NL_CB_VALID, NL_CB_CUSTOM, HandleAddrMsg, &ctx); ret < 0) {
+        return NLToAosErr(ret, "failed to set address callback");
+    }
 
-            if (err = addresses.PushBack(ipAddr); !err.IsNone()) {
-                return AOS_ERROR_WRAP(err);
-            }
-        }
+    if (auto ret = nl_recvmsgs_default(sock.get()); ret < 0) {
+        return NLToAosErr(ret, "failed to receive addresses");
     }
 
-    return ErrorEnum::eNone;
+    return ctx.mErr;
 }
 
 Error InterfaceManager::AddAddr(const String& ifname, const IPAddr& addr)
@@ -401,73 +576,7 @@ Error InterfaceManager::AddAddr(const String& ifname, const IPAddr& addr)
         return err;
     }
 
-    auto addrObj = DeferRelease(rtnl_addr_alloc(), rtnl_addr_put);
-    if (!addrObj) {
-        return NLToAosErr(errno, "failed to allocate address object");
-    }
-
-    // Resolve the ifindex via if_nametoindex (ioctl) instead of dumping the link table.
-    unsigned int ifindexU = if_nametoindex(ifname.CStr());
-    if (ifindexU == 0) {
-        return AOS_ERROR_WRAP(
-            Error(ErrorEnum::eNotFound, ("failed to get interface " + std::string(ifname.CStr())).c_str()));
-    }
-
-    int ifindex = static_cast<int>(ifindexU);
-
-    rtnl_addr_set_ifindex(addrObj.Get(), ifindex);
-
-    struct nl_addr* local;
-
-    if (auto errLocal = nl_addr_parse(addr.mIP.c_str(), addr.mFamily, &local); errLocal < 0) {
-        return NLToAosErr(errLocal, ("failed to parse IP address " + std::string(addr.mIP)));
-    }
-
-    [[maybe_unused]] auto cleanupLocal = DeferRelease(local, [](nl_addr* addr) { nl_addr_put(addr); });
-
-    rtnl_addr_set_local(addrObj.Get(), local);
-
-    if (!addr.mSubnet.empty()) {
-        struct nl_addr* subnet;
-
-        if (auto errSubnet = nl_addr_parse(addr.mSubnet.c_str(), addr.mFamily, &subnet); errSubnet < 0) {
-            return NLToAosErr(errSubnet, ("failed to parse subnet CIDR " + std::string(addr.mSubnet)));
-        }
-
-        [[maybe_unused]] auto cleanupSubnet = DeferRelease(subnet, [](nl_addr* addr) { nl_addr_put(addr); });
-        int                   prefixlen     = nl_addr_get_prefixlen(subnet);
-
-        rtnl_addr_set_prefixlen(addrObj.Get(), prefixlen);
-
-        struct in_addr ipAddr, netmask, broadcast;
-        inet_pton(AF_INET, addr.mIP.c_str(), &ipAddr);
-
-        netmask.s_addr = htonl(~((1UL << (32 - prefixlen)) - 1));
-
-        // Calculate broadcast: broadcast = ip | ~netmask
-        broadcast.s_addr = (ipAddr.s_addr & netmask.s_addr) | ~netmask.s_addr;
-
-        char brdStr[INET_ADDRSTRLEN];
-
-        inet_ntop(AF_INET, &broadcast, brdStr, INET_ADDRSTRLEN);
-
-        struct nl_addr* brd;
-
-        if (nl_addr_parse(brdStr, addr.mFamily, &brd) >= 0) {
-            [[maybe_unused]] auto cleanupBrd = DeferRelease(brd, [](nl_addr* addr) { nl_addr_put(addr); });
-            rtnl_addr_set_broadcast(addrObj.Get(), brd);
-        }
-    }
-
-    if (!addr.mLabel.empty()) {
-        rtnl_addr_set_label(addrObj.Get(), addr.mLabel.c_str());
-    }
-
-    if (auto errAddrAdd = rtnl_addr_add(sock.get(), addrObj.Get(), 0); errAddrAdd < 0 && errAddrAdd != -NLE_EXIST) {
-        return NLToAosErr(errAddrAdd, "failed to add address");
-    }
-
-    return ErrorEnum::eNone;
+    return AddLinkAddr(sock.get(), ifname, addr);
 }
 
 Error InterfaceManager::DeleteAddr(const String& ifname, const IPAddr& addr)
@@ -484,13 +593,12 @@ Error InterfaceManager::DeleteAddr(const String& ifname, const IPAddr& addr)
         return NLToAosErr(errno, "failed to allocate address object");
     }
 
-    auto [link, linkErr] = AllocLink();
-    if (!linkErr.IsNone()) {
-        return linkErr;
+    auto [ifindex, indexErr] = GetLinkIndex(ifname);
+    if (!indexErr.IsNone()) {
+        return indexErr;
     }
 
-    rtnl_link_set_name(link.get(), ifname.CStr());
-    rtnl_addr_set_ifindex(addrObj.Get(), rtnl_link_get_ifindex(link.get()));
+    rtnl_addr_set_ifindex(addrObj.Get(), ifindex);
 
     struct nl_addr* local;
 
@@ -757,18 +865,23 @@ Error InterfaceManager::ConfigureInstanceInterface(
     addr.mFamily = AF_INET;
 
     // All three steps run inside the instance netns in a single namespace entry
-    // (one setns pair) instead of one per operation. Each callee is invoked with
-    // an empty netNSPath so it operates in the already-entered namespace.
+    // (one setns pair) and share one netlink socket instead of opening one per
+    // operation.
     auto doConfigure = [&]() -> Error {
-        if (auto err = SetupLink(ifname); !err.IsNone()) {
+        auto [sock, err] = CreateNetlinkSocket();
+        if (!err.IsNone()) {
             return err;
         }
 
-        if (auto err = AddAddr(ifname, addr); !err.IsNone()) {
+        if (err = SetLinkUp(sock.get(), ifname); !err.IsNone()) {
             return err;
         }
 
-        if (auto err = AddRoute("0.0.0.0/0", gateway, ""); !err.IsNone()) {
+        if (err = AddLinkAddr(sock.get(), ifname, addr); !err.IsNone()) {
+            return err;
+        }
+
+        if (err = AddGatewayRoute(sock.get(), "0.0.0.0/0", gateway); !err.IsNone()) {
             return err;
         }
 
@@ -795,20 +908,18 @@ Error InterfaceManager::MoveLinkToNamespace(const String& ifname, const String&
         return err;
     }
 
-    nl_cache* cacheRaw;
-
-    if (auto errCache = rtnl_link_alloc_cache(sock.get(), AF_UNSPEC, &cacheRaw); errCache < 0) {
-        return NLToAosErr(errCache, "failed to allocate link cache");
+    auto [ifindex, indexErr] = GetLinkIndex(ifname);
+    if (!indexErr.IsNone()) {
+        return indexErr;
     }
 
-    [[maybe_unused]] auto cleanupCache = DeferRelease(cacheRaw, [](nl_cache* cache) { nl_cache_free(cache); });
-
-    auto link = DeferRelease(rtnl_link_get_by_name(cacheRaw, ifname.CStr()), rtnl_link_put);
+    auto link = DeferRelease(rtnl_link_alloc(), rtnl_link_put);
     if (!link) {
-        return AOS_ERROR_WRAP(
-            Error(ErrorEnum::eFailed, ("interface not found: " + std::string(ifname.CStr())).c_str()));
+        return NLToAosErr(errno, "failed to allocate link object");
     }
 
+    rtnl_link_set_ifindex(link.Get(), ifindex);
+
     auto change = DeferRelease(rtnl_link_alloc(), rtnl_link_put);
     if (!change) {
         return NLToAosErr(errno, "failed to allocate link change object");
@@ -833,20 +944,18 @@ Error InterfaceManager::RenameLink(const String& ifname, const String& newName,
             return err;
         }
 
-        nl_cache* cacheRaw;
-
-        if (auto errCache = rtnl_link_alloc_cache(sock.get(), AF_UNSPEC, &cacheRaw); errCache < 0) {
-            return NLToAosErr(errCache, "failed to allocate link cache");
+        auto [ifindex, indexErr] = GetLinkIndex(ifname);
+        if (!indexErr.IsNone()) {
+            return indexErr;
         }
 
-        [[maybe_unused]] auto cleanupCache = DeferRelease(cacheRaw, [](nl_cache* cache) { nl_cache_free(cache); });
-
-        auto link = DeferRelease(rtnl_link_get_by_name(cacheRaw, ifname.CStr()), rtnl_link_put);
+        auto link = DeferRelease(rtnl_link_alloc(), rtnl_link_put);
         if (!link) {
-            return AOS_ERROR_WRAP(
-                Error(ErrorEnum::eFailed, ("interface not found: " + std::string(ifname.CStr())).c_str()));
+            return NLToAosErr(errno, "failed to allocate link object");
         }
 
+        rtnl_link_set_ifindex(link.Get(), ifindex);
+
         auto change = DeferRelease(rtnl_link_alloc(), rtnl_link_put);
         if (!change) {
             return NLToAosErr(errno, "failed to allocate link change object");
@@ -901,51 +1010,7 @@ Error InterfaceManager::AddRoute(const String& destination, const String& gatewa
             return err;
         }
 
-        auto route = DeferRelease(rtnl_route_alloc(), rtnl_route_put);
-        if (!route) {
-            return NLToAosErr(errno, "failed to allocate route");
-        }
-
-        rtnl_route_set_scope(route.Get(), RT_SCOPE_UNIVERSE);
-        rtnl_route_set_table(route.Get(), RT_TABLE_MAIN);
-        rtnl_route_set_protocol(route.Get(), RTPROT_STATIC);
-
-        struct nl_addr* dst = nullptr;
-
-        if (nl_addr_parse(destination.CStr(), AF_INET, &dst) < 0) {
-            return AOS_ERROR_WRAP(
-                Error(ErrorEnum::eFailed, ("failed to parse destination: " + std::string(destination.CStr())).c_str()));
-        }
-
-        [[maybe_unused]] auto cleanupDst = DeferRelease(dst, [](nl_addr* a) { nl_addr_put(a); });
-
-        rtnl_route_set_dst(route.Get(), dst);
-
-        auto* nh = rtnl_route_nh_alloc();
-        if (!nh) {
-            return NLToAosErr(errno, "failed to allocate nexthop");
-        }
-
-        struct nl_addr* gw = nullptr;
-
-        if (nl_addr_parse(gateway.CStr(), AF_INET, &gw) < 0) {
-            rtnl_route_nh_free(nh);
-
-            return AOS_ERROR_WRAP(
-                Error(ErrorEnum::eFailed, ("failed to parse gateway: " + std::string(gateway.CStr())).c_str()));
-        }
-
-        [[maybe_unused]] auto cleanupGw = DeferRelease(gw, [](nl_addr* a) { nl_addr_put(a); });
-
-        rtnl_route_nh_set_gateway(nh, gw);
-        rtnl_route_add_nexthop(route.Get(), nh);
-        // rtnl_route_add_nexthop takes ownership of nh — no separate free.
-
-        if (auto errAdd = rtnl_route_add(sock.get(), route.Get(), NLM_F_CREATE); errAdd < 0) {
-            return NLToAosErr(errAdd, "failed to add route");
-        }
-
-        return ErrorEnum::eNone;
+        return AddGatewayRoute(sock.get(), destination, gateway);
     };
 
     if (netNSPath.IsEmpty()) {
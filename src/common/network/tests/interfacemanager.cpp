@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <common/network/interfacemanager.hpp>
+
+using namespace testing;
+
+namespace aos::common::network {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+constexpr auto cLoopback    = "lo";
+constexpr auto cMaxAddrs    = 16;
+constexpr auto cLoopbackIP4 = "127.0.0.1";
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class InterfaceManagerTest : public Test {
+protected:
+    void SetUp() override { tests::utils::InitLog(); }
+
+    InterfaceManager mInterfaceManager;
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+// Addresses used to be matched against ifindex 0, so no address was ever returned.
+TEST_F(InterfaceManagerTest, GetAddrListReturnsInterfaceAddresses)
+{
+    StaticArray<IPAddr, cMaxAddrs> addresses;
+
+    ASSERT_TRUE(mInterfaceManager.GetAddrList(cLoopback, AF_INET, addresses).IsNone());
+    ASSERT_FALSE(addresses.IsEmpty());
+
+    for (const auto& addr : addresses) {
+        EXPECT_EQ(addr.mFamily, AF_INET);
+        EXPECT_EQ(addr.mIP.rfind("127.", 0), 0) << "unexpected address: " << addr.mIP;
+    }
+
+    auto it = std::find_if(
+        addresses.begin(), addresses.end(), [](const IPAddr& addr) { return addr.mIP.rfind(cLoopbackIP4, 0) == 0; });
+
+    EXPECT_NE(it, addresses.end());
+}
+
+TEST_F(InterfaceManagerTest, GetAddrListFiltersFamily)
+{
+    StaticArray<IPAddr, cMaxAddrs> all;
+    StaticArray<IPAddr, cMaxAddrs> ip4;
+
+    ASSERT_TRUE(mInterfaceManager.GetAddrList(cLoopback, AF_UNSPEC, all).IsNone());
+    ASSERT_TRUE(mInterfaceManager.GetAddrList(cLoopback, AF_INET, ip4).IsNone());
+
+    auto numIP4 = std::count_if(all.begin(), all.end(), [](const IPAddr& addr) { return addr.mFamily == AF_INET; });
+
+    EXPECT_EQ(static_cast<size_t>(numIP4), ip4.Size());
+}
+
+TEST_F(InterfaceManagerTest, GetAddrListUnknownInterface)
+{
+    StaticArray<IPAddr, cMaxAddrs> addresses;
+
+    EXPECT_TRUE(mInterfaceManager.GetAddrList("unknown0", AF_UNSPEC, addresses).Is(ErrorEnum::eNotFound));
+    EXPECT_TRUE(addresses.IsEmpty());
+}
+
+} // namespace aos::common::network
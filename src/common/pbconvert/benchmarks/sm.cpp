@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <common/pbconvert/sm.hpp>
+
+namespace aos::common::pbconvert {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+servicemanager::v5::InstanceStatus CreateInstanceStatus()
+{
+    servicemanager::v5::InstanceStatus status;
+
+    status.mutable_instance()->set_item_id("service1");
+    status.mutable_instance()->set_subject_id("user1");
+    status.mutable_instance()->set_instance(0);
+    status.set_version("2.0.0");
+    status.set_runtime_id("crun");
+    status.set_state("active");
+    status.set_manifest_digest("sha256:36f028580bb02cc8272a9a020f4200e346e276ae664e45ee80745574e2f5ab80");
+
+    for (auto i = 0; i < 4; i++) {
+        status.add_env_vars()->set_name("VAR" + std::to_string(i));
+    }
+
+    return status;
+}
+
+servicemanager::v5::AverageMonitoring CreateAverageMonitoring(size_t numInstances)
+{
+    servicemanager::v5::AverageMonitoring monitoring;
+
+    auto* nodeData = monitoring.mutable_node_monitoring();
+
+    nodeData->set_ram(2048);
+    nodeData->set_cpu(75);
+    nodeData->set_download(300);
+    nodeData->set_upload(400);
+
+    auto* partition = nodeData->add_partitions();
+
+    partition->set_name("var");
+    partition->set_used_size(1024);
+
+    for (size_t i = 0; i < numInstances; i++) {
+        auto* instance = monitoring.add_instances_monitoring();
+
+        instance->mutable_instance()->set_item_id("item" + std::to_string(i));
+        instance->mutable_instance()->set_subject_id("subject");
+        instance->mutable_instance()->set_instance(0);
+        instance->set_runtime_id("crun");
+        instance->mutable_monitoring_data()->set_ram(512);
+        instance->mutable_monitoring_data()->set_cpu(25.0);
+    }
+
+    return monitoring;
+}
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_ConvertInstanceStatusFromProto(benchmark::State& state)
+{
+    const auto grpcStatus = CreateInstanceStatus();
+    auto       aosStatus  = std::make_unique<InstanceStatus>();
+
+    for (auto _ : state) {
+        // Converters append to arrays, so they are cleared to not overflow.
+        aosStatus->mEnvVarsStatuses.Clear();
+
+        if (auto err = ConvertFromProto(grpcStatus, String("node1"), *aosStatus); !err.IsNone()) {
+            state.SkipWithError("can't convert instance status");
+
+            break;
+        }
+    }
+}
+
+BENCHMARK(BM_ConvertInstanceStatusFromProto);
+
+void BM_ConvertAverageMonitoringFromProto(benchmark::State& state)
+{
+    const auto grpcMonitoring = CreateAverageMonitoring(state.range(0));
+    auto       aosMonitoring  = std::make_unique<monitoring::NodeMonitoringData>();
+
+    for (auto _ : state) {
+        aosMonitoring->mMonitoringData.mPartitions.Clear();
+        aosMonitoring->mInstances.Clear();
+
+        if (auto err = ConvertFromProto(grpcMonitoring, String("node1"), *aosMonitoring); !err.IsNone()) {
+            state.SkipWithError("can't convert average monitoring");
+
+            break;
+        }
+    }
+}
+
+BENCHMARK(BM_ConvertAverageMonitoringFromProto)->Arg(1)->Arg(32);
+
+} // namespace
+
+} // namespace aos::common::pbconvert
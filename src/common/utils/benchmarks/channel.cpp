@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <common/utils/channel.hpp>
+
+namespace aos::common::utils {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_ChannelSendReceive(benchmark::State& state)
+{
+    Channel<int> channel(state.range(0));
+
+    for (auto _ : state) {
+        channel.Send(1);
+
+        benchmark::DoNotOptimize(channel.Receive());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ChannelSendReceive)->Arg(1)->Arg(64);
+
+void BM_ChannelThroughput(benchmark::State& state)
+{
+    const auto cNumMessages = state.range(1);
+
+    for (auto _ : state) {
+        Channel<int> channel(state.range(0));
+
+        std::thread producer([&channel, cNumMessages]() {
+            for (int64_t i = 0; i < cNumMessages; i++) {
+                channel.Send(static_cast<int>(i));
+            }
+
+            channel.Close();
+        });
+
+        while (channel.Receive().mError.IsNone()) { }
+
+        producer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * cNumMessages);
+}
+
+BENCHMARK(BM_ChannelThroughput)->Args({1, 10000})->Args({64, 10000})->Args({1024, 10000})->UseRealTime();
+
+} // namespace
+
+} // namespace aos::common::utils
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include <benchmark/benchmark.h>
+
+#include <common/utils/image.hpp>
+
+namespace aos::common::utils {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+const auto cTestDir = std::filesystem::temp_directory_path() / "aos_image_benchmark";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+void CreateTestDir(size_t numFiles, size_t fileSize)
+{
+    std::filesystem::remove_all(cTestDir);
+
+    const std::string content(fileSize, 'a');
+
+    for (size_t i = 0; i < numFiles; i++) {
+        auto dir = cTestDir / ("dir" + std::to_string(i % 10));
+
+        std::filesystem::create_directories(dir);
+
+        std::ofstream(dir / ("file" + std::to_string(i))) << content;
+    }
+}
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_CalculateDirDigest(benchmark::State& state)
+{
+    const auto numFiles = static_cast<size_t>(state.range(0));
+    const auto fileSize = static_cast<size_t>(state.range(1));
+
+    CreateTestDir(numFiles, fileSize);
+
+    for (auto _ : state) {
+        auto [digest, err] = CalculateDirDigest(cTestDir.string());
+        if (!err.IsNone()) {
+            state.SkipWithError("can't calculate dir digest");
+
+            break;
+        }
+
+        benchmark::DoNotOptimize(digest);
+    }
+
+    state.SetBytesProcessed(state.iterations() * numFiles * fileSize);
+
+    std::filesystem::remove_all(cTestDir);
+}
+
+BENCHMARK(BM_CalculateDirDigest)->Args({100, 4096})->Args({10, 1024 * 1024})->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+} // namespace aos::common::utils
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <common/utils/json.hpp>
+
+namespace aos::common::utils {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+std::string CreateTestJSON(size_t numItems)
+{
+    auto items = Poco::makeShared<Poco::JSON::Array>();
+
+    for (size_t i = 0; i < numItems; i++) {
+        auto item = Poco::makeShared<Poco::JSON::Object>();
+
+        item->set("itemID", "item" + std::to_string(i));
+        item->set("version", "1.0.0");
+        item->set("ownerID", "owner");
+        item->set("priority", i);
+        item->set("labels", Poco::JSON::Array());
+
+        items->add(item);
+    }
+
+    auto json = Poco::makeShared<Poco::JSON::Object>();
+
+    json->set("messageType", "desiredStatus");
+    json->set("items", items);
+
+    return Stringify(json);
+}
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_ParseJson(benchmark::State& state)
+{
+    const auto json = CreateTestJSON(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ParseJson(json));
+    }
+
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+BENCHMARK(BM_ParseJson)->Arg(1)->Arg(100);
+
+void BM_Stringify(benchmark::State& state)
+{
+    auto [json, err] = ParseJson(CreateTestJSON(state.range(0)));
+    if (!err.IsNone()) {
+        state.SkipWithError("can't parse json");
+
+        return;
+    }
+
+    std::string buffer;
+
+    for (auto _ : state) {
+        buffer.clear();
+
+        Stringify(json, buffer);
+
+        benchmark::DoNotOptimize(buffer);
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(BM_Stringify)->Arg(1)->Arg(100);
+
+void BM_CaseInsensitiveGetValue(benchmark::State& state)
+{
+    auto [json, err] = ParseJson(CreateTestJSON(1));
+    if (!err.IsNone()) {
+        state.SkipWithError("can't parse json");
+
+        return;
+    }
+
+    auto item = json.extract<Poco::JSON::Object::Ptr>()->getArray("items")->getObject(0);
+
+    for (auto _ : state) {
+        CaseInsensitiveObjectWrapper wrapper(item);
+
+        benchmark::DoNotOptimize(wrapper.GetValue<std::string>("ItemId"));
+        benchmark::DoNotOptimize(wrapper.GetValue<std::string>("Version"));
+        benchmark::DoNotOptimize(wrapper.GetValue<uint64_t>("Priority"));
+    }
+}
+
+BENCHMARK(BM_CaseInsensitiveGetValue);
+
+} // namespace
+
+} // namespace aos::common::utils
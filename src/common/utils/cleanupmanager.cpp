@@ -14,11 +14,15 @@ namespace aos::common::utils {
 
 void CleanupManager::AddCleanup(std::function<void()>&& cleanup)
 {
+    std::lock_guard lock {mMutex};
+
     mCleanups.push_back(std::move(cleanup));
 }
 
 void CleanupManager::ExecuteCleanups()
 {
+    std::lock_guard lock {mMutex};
+
     for (auto it = mCleanups.rbegin(); it != mCleanups.rend(); ++it) {
         (*it)();
     }
@@ -8,6 +8,7 @@
 #define AOS_COMMON_UTILS_CLEANUPMANAGER_HPP_
 
 #include <functional>
+#include <mutex>
 #include <vector>
 
 namespace aos::common::utils {
@@ -17,7 +18,7 @@ namespace aos::common::utils {
 class CleanupManager {
 public:
     /**
-     * Adds cleanup.
+     * Adds cleanup. Can be called concurrently, e.g. from parallel startup steps.
      */
     void AddCleanup(std::function<void()>&& cleanup);
 
@@ -27,6 +28,7 @@ public:
     void ExecuteCleanups();
 
 private:
+    std::mutex                         mMutex;
     std::vector<std::function<void()>> mCleanups;
 };
 
@@ -4,15 +4,18 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <poll.h>
+#include <fcntl.h>
 #include <spawn.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <condition_variable>
 #include <iterator>
+#include <mutex>
 #include <sstream>
-#include <string_view>
 
 #include <core/common/tools/memory.hpp>
 
@@ -109,26 +112,204 @@ Error CheckExitCode(int rc, const std::string& output, const std::initializer_li
     return Error(ErrorEnum::eRuntime, err.str().c_str());
 }
 
-} // namespace
+// Limits the number of concurrently running commands, so bursts of provisioning/image commands don't fork more
+// processes than the node can run.
+class ExecLimiter {
+public:
+    static ExecLimiter& Get()
+    {
+        static ExecLimiter sLimiter;
 
-/***********************************************************************************************************************
- * Public
- **********************************************************************************************************************/
+        return sLimiter;
+    }
 
-RetWithError<std::string> ExecCommand(
-    const std::vector<std::string>& args, const std::initializer_list<int>& expectedExitCodes)
+    void SetLimit(size_t limit)
+    {
+        std::lock_guard lock {mMutex};
+
+        mLimit = limit;
+
+        mCondVar.notify_all();
+    }
+
+    void Acquire()
+    {
+        std::unique_lock lock {mMutex};
+
+        mCondVar.wait(lock, [this]() { return mLimit == 0 || mNumRunning < mLimit; });
+
+        mNumRunning++;
+    }
+
+    void Release()
+    {
+        std::lock_guard lock {mMutex};
+
+        mNumRunning--;
+
+        mCondVar.notify_one();
+    }
+
+private:
+    std::mutex              mMutex;
+    std::condition_variable mCondVar;
+    size_t                  mLimit = cDefaultMaxConcurrentExecs;
+    size_t                  mNumRunning {};
+};
+
+int OpenPidFD(pid_t pid)
+{
+#ifdef SYS_pidfd_open
+    return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    (void)pid;
+
+    errno = ENOSYS;
+
+    return -1;
+#endif
+}
+
+void CloseFD(int* fd)
+{
+    if (*fd >= 0) {
+        close(*fd);
+    }
+}
+
+// Reads all available output. Returns false once the pipe reaches EOF or fails.
+bool DrainPipe(int fd, const ExecOutputHandler& outputHandler)
+{
+    char buffer[4096];
+
+    for (;;) {
+        const auto n = read(fd, buffer, sizeof(buffer));
+        if (n > 0) {
+            if (outputHandler) {
+                outputHandler(std::string_view(buffer, static_cast<size_t>(n)));
+            }
+
+            continue;
+        }
+
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+
+        return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+    }
+}
+
+// Waits for the command to exit while passing its output to the handler. The child exit is signaled by pidfd, so
+// output and exit are handled as soon as they happen instead of on poll timeouts. Kernels without pidfd (< 5.3) fall
+// back to checking the child with WNOHANG on a short epoll timeout.
+//
+// The pipe is drained while the command is still running rather than after it exits: once the pipe buffer fills up,
+// the command would block in write() while this process blocked in waitpid(), deadlocking both sides. A detached
+// grandchild process can inherit the pipe's write end and keep it open indefinitely, so once the launched command
+// itself has exited, only what's already buffered is drained instead of reading until EOF.
+Error WaitForCommand(pid_t pid, int outFD, const ExecOutputHandler& outputHandler, int& rc)
+{
+    constexpr int cFallbackTimeoutMs = 20;
+
+    int  pidFD    = OpenPidFD(pid);
+    int  epollFD  = epoll_create1(EPOLL_CLOEXEC);
+    auto closePid = DeferRelease(&pidFD, CloseFD);
+    auto closeEp  = DeferRelease(&epollFD, CloseFD);
+    int  status   = 0;
+
+    auto waitExit = [&]() {
+        while (waitpid(pid, &status, 0) < 0 && errno == EINTR) { }
+
+        rc = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    };
+
+    if (epollFD < 0) {
+        auto err = Error(errno, "can't create epoll");
+
+        waitExit();
+
+        return err;
+    }
+
+    epoll_event ev {};
+
+    ev.events  = EPOLLIN;
+    ev.data.fd = outFD;
+
+    epoll_ctl(epollFD, EPOLL_CTL_ADD, outFD, &ev);
+
+    if (pidFD >= 0) {
+        ev.data.fd = pidFD;
+
+        epoll_ctl(epollFD, EPOLL_CTL_ADD, pidFD, &ev);
+    }
+
+    bool outOpen = true;
+    bool exited  = false;
+
+    while (!exited) {
+        epoll_event events[2];
+
+        const auto n = epoll_wait(epollFD, events, 2, pidFD >= 0 ? -1 : cFallbackTimeoutMs);
+        if (n < 0 && errno != EINTR) {
+            auto err = Error(errno, "can't wait for command");
+
+            waitExit();
+
+            return err;
+        }
+
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.fd == pidFD) {
+                exited = true;
+            } else if (outOpen && !DrainPipe(outFD, outputHandler)) {
+                outOpen = false;
+
+                epoll_ctl(epollFD, EPOLL_CTL_DEL, outFD, nullptr);
+            }
+        }
+
+        if (pidFD < 0 && waitpid(pid, &status, WNOHANG) == pid) {
+            rc = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+
+            exited = true;
+            pid    = -1;
+        }
+    }
+
+    if (outOpen) {
+        DrainPipe(outFD, outputHandler);
+    }
+
+    if (pid >= 0) {
+        waitExit();
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error RunCommand(const std::vector<std::string>& args, const ExecOutputHandler& outputHandler, int& rc)
 {
+    ExecLimiter::Get().Acquire();
+
+    auto releaseLimiter = DeferRelease(&ExecLimiter::Get(), [](ExecLimiter* limiter) { limiter->Release(); });
+
+    // The pipe is close-on-exec, so commands spawned concurrently by other threads don't inherit it and keep it open.
     int pipeFDs[2];
 
-    if (pipe(pipeFDs) != 0) {
-        return {"", Error(ErrorEnum::eRuntime, "can't create pipe")};
+    if (pipe2(pipeFDs, O_CLOEXEC) != 0) {
+        return Error(ErrorEnum::eRuntime, "can't create pipe");
     }
 
     auto closePipe = DeferRelease(&pipeFDs, [](int(*fds)[2]) {
-        close((*fds)[0]);
-        close((*fds)[1]);
+        CloseFD(&(*fds)[0]);
+        CloseFD(&(*fds)[1]);
     });
 
+    // Only the read end is non-blocking: the write end is shared with the child's stdout/stderr.
+    fcntl(pipeFDs[0], F_SETFL, fcntl(pipeFDs[0], F_GETFL) | O_NONBLOCK);
+
     posix_spawn_file_actions_t actions;
 
     posix_spawn_file_actions_init(&actions);
@@ -137,59 +318,65 @@ RetWithError<std::string> ExecCommand(
 
     posix_spawn_file_actions_adddup2(&actions, pipeFDs[1], STDOUT_FILENO);
     posix_spawn_file_actions_adddup2(&actions, pipeFDs[1], STDERR_FILENO);
-    posix_spawn_file_actions_addclose(&actions, pipeFDs[0]);
-    posix_spawn_file_actions_addclose(&actions, pipeFDs[1]);
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34))
+    // Don't leak descriptors opened without close-on-exec into the command.
+    posix_spawn_file_actions_addclosefrom_np(&actions, STDERR_FILENO + 1);
+#endif
 
     pid_t pid = -1;
 
-    Error err = SpawnProcess(args, &actions, pid);
-    if (!err.IsNone()) {
-        return {"", err};
+    if (auto err = SpawnProcess(args, &actions, pid); !err.IsNone()) {
+        return err;
     }
 
-    // Drain the pipe while the launched command is still running rather than waiting for it to exit first:
-    // once the pipe buffer fills up, the command would block in write() while this process blocked in
-    // waitpid(), deadlocking both sides. A detached grandchild process can inherit the pipe's write end and
-    // keep it open indefinitely, so once the launched command itself has exited, only what's already
-    // buffered is drained instead of reading until EOF.
-    constexpr int cPollTimeoutMs = 20;
+    // Close the write end in this process, so the pipe reaches EOF as soon as the command and its children exit.
+    close(pipeFDs[1]);
+    pipeFDs[1] = -1;
 
-    std::string outStr;
-    char        buffer[1024];
-    int         status = 0;
-    bool        exited = false;
+    return WaitForCommand(pid, pipeFDs[0], outputHandler, rc);
+}
 
-    for (;;) {
-        pollfd pfd {pipeFDs[0], POLLIN, 0};
+} // namespace
 
-        if (poll(&pfd, 1, exited ? 0 : cPollTimeoutMs) > 0 && (pfd.revents & POLLIN)) {
-            const int n = read(pipeFDs[0], buffer, sizeof(buffer));
-            if (n > 0) {
-                outStr.append(buffer, n);
-                continue;
-            }
-        }
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
 
-        if (exited) {
-            break;
-        }
+RetWithError<std::string> ExecCommand(
+    const std::vector<std::string>& args, const std::initializer_list<int>& expectedExitCodes)
+{
+    std::string outStr;
+    int         rc = -1;
 
-        if (waitpid(pid, &status, WNOHANG) == pid) {
-            exited = true;
-        }
+    auto err = RunCommand(args, [&outStr](std::string_view chunk) { outStr.append(chunk); }, rc);
+    if (!err.IsNone()) {
+        return {"", err};
     }
 
-    const int rc = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
-
     return {outStr, CheckExitCode(rc, outStr, expectedExitCodes)};
 }
 
+Error ExecStreamCommand(const std::vector<std::string>& args, const ExecOutputHandler& outputHandler,
+    const std::initializer_list<int>& expectedExitCodes)
+{
+    int rc = -1;
+
+    if (auto err = RunCommand(args, outputHandler, rc); !err.IsNone()) {
+        return err;
+    }
+
+    return CheckExitCode(rc, "", expectedExitCodes);
+}
+
 Error ExecDetachedCommand(const std::vector<std::string>& args, const std::initializer_list<int>& expectedExitCodes)
 {
     // No pipe/file actions here: the spawned process inherits this process's actual stdout/stderr. This is
     // for commands that daemonize a long-running process expected to keep producing output for its whole
     // lifetime, which a pipe capturing just the launcher command's own short-lived setup output isn't
     // suited for.
+    //
+    // Detached commands bypass the exec limiter: they launch instances and shouldn't queue behind image or
+    // provisioning commands.
     pid_t pid = -1;
 
     if (auto err = SpawnProcess(args, nullptr, pid); !err.IsNone()) {
@@ -199,4 +386,9 @@ Error ExecDetachedCommand(const std::vector<std::string>& args, const std::initi
     return CheckExitCode(WaitForExitCode(pid), "", expectedExitCodes);
 }
 
+void SetMaxConcurrentExecs(size_t maxExecs)
+{
+    ExecLimiter::Get().SetLimit(maxExecs);
+}
+
 } // namespace aos::common::utils
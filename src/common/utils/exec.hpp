@@ -7,8 +7,10 @@
 #ifndef AOS_COMMON_UTILS_EXEC_HPP_
 #define AOS_COMMON_UTILS_EXEC_HPP_
 
+#include <functional>
 #include <initializer_list>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <core/common/tools/error.hpp>
@@ -16,6 +18,16 @@
 
 namespace aos::common::utils {
 
+/**
+ * Command output handler, called with output chunks as soon as they are read.
+ */
+using ExecOutputHandler = std::function<void(std::string_view chunk)>;
+
+/**
+ * Default max number of commands executed concurrently, 0 means unlimited.
+ */
+constexpr size_t cDefaultMaxConcurrentExecs = 0;
+
 /**
  * Executes command and return its output.
  *
@@ -26,6 +38,17 @@ namespace aos::common::utils {
 RetWithError<std::string> ExecCommand(
     const std::vector<std::string>& args, const std::initializer_list<int>& expectedExitCodes = {0});
 
+/**
+ * Executes command passing its combined stdout/stderr output to the handler while the command is running.
+ *
+ * @param args command arguments (first argument is program name).
+ * @param outputHandler output handler.
+ * @param expectedExitCodes expected command exit codes (default is 0).
+ * @return Error.
+ */
+Error ExecStreamCommand(const std::vector<std::string>& args, const ExecOutputHandler& outputHandler,
+    const std::initializer_list<int>& expectedExitCodes = {0});
+
 /**
  * Executes a command that daemonizes into a long-running process, letting it inherit this process's
  * stdout/stderr instead of a pipe that would have to be closed once the immediate command exits, cutting
@@ -38,6 +61,14 @@ RetWithError<std::string> ExecCommand(
 Error ExecDetachedCommand(
     const std::vector<std::string>& args, const std::initializer_list<int>& expectedExitCodes = {0});
 
+/**
+ * Sets max number of commands executed concurrently. Commands above the limit wait for running ones to finish.
+ * Detached commands are not limited.
+ *
+ * @param maxExecs max number of concurrent commands, 0 means unlimited.
+ */
+void SetMaxConcurrentExecs(size_t maxExecs);
+
 } // namespace aos::common::utils
 
 #endif
@@ -7,10 +7,15 @@
 
 #include <cerrno>
 #include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
 #include <filesystem>
+#include <linux/fs.h>
 #include <mntent.h>
 #include <numeric>
+#include <set>
 #include <string>
+#include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <vector>
@@ -18,6 +23,8 @@
 #include <Poco/UUID.h>
 #include <Poco/UUIDGenerator.h>
 
+#include <core/common/tools/memory.hpp>
+
 #include "exception.hpp"
 #include "filesystem.hpp"
 
@@ -31,7 +38,221 @@ namespace {
  * Consts
  **********************************************************************************************************************/
 
-constexpr auto cMtabPath = "/proc/mounts";
+constexpr auto cMtabPath    = "/proc/mounts";
+constexpr auto cCopyBufSize = 1024 * 1024;
+constexpr auto cFileMode    = 0644;
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+Error CopyFileRange(int srcFd, int dstFd, size_t& size)
+{
+    while (size > 0) {
+        auto count = copy_file_range(srcFd, nullptr, dstFd, nullptr, size, 0);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (errno == EXDEV || errno == EINVAL || errno == ENOSYS || errno == EOPNOTSUPP) {
+                return ErrorEnum::eNotSupported;
+            }
+
+            return Error(ErrorEnum::eFailed, strerror(errno));
+        }
+
+        if (count == 0) {
+            size = 0;
+
+            break;
+        }
+
+        size -= static_cast<size_t>(count);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error CopyFileData(int srcFd, int dstFd)
+{
+    std::vector<char> buffer(cCopyBufSize);
+
+    while (true) {
+        auto count = read(srcFd, buffer.data(), buffer.size());
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return Error(ErrorEnum::eFailed, strerror(errno));
+        }
+
+        if (count == 0) {
+            return ErrorEnum::eNone;
+        }
+
+        for (ssize_t written = 0; written < count;) {
+            auto res = write(dstFd, buffer.data() + written, count - written);
+            if (res < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                return Error(ErrorEnum::eFailed, strerror(errno));
+            }
+
+            written += res;
+        }
+    }
+}
+
+// Copies file content by cloning extents, then in kernel, then through user space. If cloneOnly is set and the
+// file can't be cloned, eNotSupported is returned.
+Error CopyFileToPath(const std::string& src, const std::string& dst, bool cloneOnly)
+{
+    auto srcFd = open(src.c_str(), O_RDONLY | O_CLOEXEC);
+    if (srcFd < 0) {
+        return Error(errno == ENOENT ? ErrorEnum::eNotFound : ErrorEnum::eFailed, strerror(errno));
+    }
+
+    [[maybe_unused]] auto closeSrc = DeferRelease(&srcFd, [](const int* fd) { close(*fd); });
+
+    struct stat srcStat;
+
+    if (fstat(srcFd, &srcStat) != 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    auto dstFd = open(dst.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, srcStat.st_mode & 0777);
+    if (dstFd < 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    [[maybe_unused]] auto closeDst = DeferRelease(&dstFd, [](const int* fd) { close(*fd); });
+
+    if (ioctl(dstFd, FICLONE, srcFd) != 0) {
+        if (cloneOnly) {
+            return ErrorEnum::eNotSupported;
+        }
+
+        auto size = static_cast<size_t>(srcStat.st_size);
+
+        auto err = CopyFileRange(srcFd, dstFd, size);
+        if (err.Is(ErrorEnum::eNotSupported)) {
+            // Copy the rest through user space.
+            err = CopyFileData(srcFd, dstFd);
+        }
+
+        if (!err.IsNone()) {
+            return err;
+        }
+    }
+
+    if (fdatasync(dstFd) != 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    return ErrorEnum::eNone;
+}
+
+bool IsSameDevice(const std::string& src, const std::string& dst)
+{
+    auto dstDir = fs::path(dst).parent_path();
+
+    struct stat srcStat;
+    struct stat dstDirStat;
+
+    if (stat(src.c_str(), &srcStat) != 0 || stat(dstDir.empty() ? "." : dstDir.c_str(), &dstDirStat) != 0) {
+        return false;
+    }
+
+    return srcStat.st_dev == dstDirStat.st_dev;
+}
+
+std::string GetTmpPath(const std::string& path)
+{
+    return path + ".tmp";
+}
+
+// Existing file keeps its permissions, a new one is created with the default mode.
+mode_t GetFileMode(const std::string& path)
+{
+    struct stat fileStat;
+
+    if (stat(path.c_str(), &fileStat) != 0) {
+        return cFileMode;
+    }
+
+    return fileStat.st_mode & 07777;
+}
+
+Error WriteFileData(int fd, const std::string& path, const std::string& content)
+{
+    if (fchmod(fd, GetFileMode(path)) != 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    for (size_t written = 0; written < content.size();) {
+        auto count = write(fd, content.data() + written, content.size() - written);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return Error(ErrorEnum::eFailed, strerror(errno));
+        }
+
+        written += static_cast<size_t>(count);
+    }
+
+    if (fdatasync(fd) != 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    return ErrorEnum::eNone;
+}
+
+// Temporary file gets a unique name next to the target, so concurrent writers of the same file don't share it and
+// rename stays within one file system.
+RetWithError<std::string> WriteTmpFile(const std::string& path, const std::string& content)
+{
+    const auto file    = fs::path(path);
+    auto       tmpPath = (file.parent_path() / ("." + file.filename().string() + ".XXXXXX")).string();
+
+    auto fd = mkostemp(tmpPath.data(), O_CLOEXEC);
+    if (fd < 0) {
+        return {"", Error(ErrorEnum::eFailed, strerror(errno))};
+    }
+
+    auto err = WriteFileData(fd, path, content);
+
+    close(fd);
+
+    if (!err.IsNone()) {
+        unlink(tmpPath.c_str());
+
+        return {"", err};
+    }
+
+    return tmpPath;
+}
+
+Error SyncDir(const std::string& dir)
+{
+    auto fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    [[maybe_unused]] auto closeFd = DeferRelease(&fd, [](const int* fd) { close(*fd); });
+
+    if (fsync(fd) != 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    return ErrorEnum::eNone;
+}
 
 }; // namespace
 
@@ -97,6 +318,93 @@ void ChangeOwner(const std::string& path, uid_t uid, gid_t gid)
     }
 }
 
+Error CopyFile(const std::string& src, const std::string& dst, bool allowHardLink)
+{
+    auto tmpPath = GetTmpPath(dst);
+
+    unlink(tmpPath.c_str());
+
+    auto hardLink = allowHardLink && IsSameDevice(src, dst);
+    auto err      = CopyFileToPath(src, tmpPath, hardLink);
+
+    // Hard link is used if the file can't be cloned: on file systems without reflinks, in-kernel copy still copies
+    // all data.
+    if (err.Is(ErrorEnum::eNotSupported)) {
+        unlink(tmpPath.c_str());
+
+        err = link(src.c_str(), tmpPath.c_str()) == 0 ? ErrorEnum::eNone : CopyFileToPath(src, tmpPath, false);
+    }
+
+    if (!err.IsNone()) {
+        unlink(tmpPath.c_str());
+
+        return err;
+    }
+
+    if (rename(tmpPath.c_str(), dst.c_str()) != 0) {
+        auto err = Error(ErrorEnum::eFailed, strerror(errno));
+
+        unlink(tmpPath.c_str());
+
+        return err;
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error WriteFileAtomically(const std::string& path, const std::string& content)
+{
+    return WriteFilesAtomically({{path, content}});
+}
+
+Error WriteFilesAtomically(const std::vector<std::pair<std::string, std::string>>& files)
+{
+    std::vector<std::string> tmpPaths;
+
+    auto removeTmpFiles = [&tmpPaths]() {
+        for (const auto& tmpPath : tmpPaths) {
+            unlink(tmpPath.c_str());
+        }
+    };
+
+    for (const auto& [path, content] : files) {
+        auto [tmpPath, err] = WriteTmpFile(path, content);
+        if (!err.IsNone()) {
+            removeTmpFiles();
+
+            return err;
+        }
+
+        tmpPaths.push_back(tmpPath);
+    }
+
+    std::set<std::string> dirs;
+
+    for (size_t i = 0; i < files.size(); i++) {
+        const auto& path = files[i].first;
+
+        if (rename(tmpPaths[i].c_str(), path.c_str()) != 0) {
+            auto err = Error(ErrorEnum::eFailed, strerror(errno));
+
+            removeTmpFiles();
+
+            return err;
+        }
+
+        auto dir = fs::path(path).parent_path();
+
+        dirs.insert(dir.empty() ? "." : dir.string());
+    }
+
+    for (const auto& dir : dirs) {
+        if (auto err = SyncDir(dir); !err.IsNone()) {
+            return err;
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
 RetWithError<std::string> GetMountPoint(const std::string& dir)
 {
     struct stat dirStat;
@@ -10,6 +10,8 @@
 
 #include <filesystem>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <core/common/tools/error.hpp>
 
@@ -48,6 +50,45 @@ RetWithError<uintmax_t> CalculateSize(const std::string& path);
  */
 void ChangeOwner(const std::string& path, uid_t uid, gid_t gid);
 
+/**
+ * Copies file.
+ *
+ * Tries to clone file extents (reflink) first, then hard link if allowed and both files are on the same device, then
+ * in-kernel copy, and falls back to user space copy. The copy is synced and the destination is replaced atomically.
+ * Hard link shares the inode with the source, so it should be allowed only if both files are never modified in place.
+ *
+ * @param src source file path.
+ * @param dst destination file path.
+ * @param allowHardLink allow to hard link destination to source.
+ * @return Error.
+ */
+Error CopyFile(const std::string& src, const std::string& dst, bool allowHardLink = false);
+
+/**
+ * Writes file atomically.
+ *
+ * Content is written to a uniquely named temporary file in the target directory which is synced and renamed over the
+ * target, then the parent directory is synced. On power loss the file contains either the old or the new content.
+ * Existing file keeps its permissions, a new one is created with 0644.
+ *
+ * @param path file path.
+ * @param content file content.
+ * @return Error.
+ */
+Error WriteFileAtomically(const std::string& path, const std::string& content);
+
+/**
+ * Writes files atomically.
+ *
+ * All files are written and synced before any of them replaces its target, so a write error leaves all targets
+ * untouched. Each parent directory is synced once. Only each file is replaced atomically, not the whole set: if a
+ * rename fails midway, the targets renamed before it already have the new content while the rest keep the old one.
+ *
+ * @param files list of file path and content pairs.
+ * @return Error.
+ */
+Error WriteFilesAtomically(const std::vector<std::pair<std::string, std::string>>& files);
+
 /**
  * Joins base path and one or more entries into a single path.
  *
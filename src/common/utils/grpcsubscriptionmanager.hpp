@@ -7,14 +7,18 @@
 #ifndef AOS_COMMON_UTILS_GRPCSUBSCRIPTIONMANAGER_HPP_
 #define AOS_COMMON_UTILS_GRPCSUBSCRIPTIONMANAGER_HPP_
 
+#include <chrono>
+#include <cstdint>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <thread>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 
+#include <grpcpp/alarm.h>
 #include <grpcpp/grpcpp.h>
 
 #include <core/common/tools/logger.hpp>
@@ -26,6 +30,9 @@ namespace aos::common::utils {
 /**
  * Generic subscription manager template that handles gRPC stream subscriptions.
  *
+ * Streams are read with the gRPC callback API and reconnects are scheduled with gRPC alarms, so subscriptions don't
+ * own threads: all of them are served by the gRPC callback thread pool.
+ *
  * @tparam TStub gRPC stub type (e.g., IAMPublicCertService::Stub).
  * @tparam TListener Listener interface type (e.g., CertListenerItf).
  * @tparam TProtoMsg Protobuf message type (e.g., iamanager::v6::CertInfo).
@@ -36,17 +43,18 @@ template <typename TStub, typename TListener, typename TProtoMsg, typename TAosT
 class GRPCSubscriptionManager {
 public:
     // Type aliases for function pointers
-    using ReaderPtr   = std::unique_ptr<grpc::ClientReader<TProtoMsg>>;
-    using ReaderFunc  = ReaderPtr (TStub::*)(grpc::ClientContext*, const TRequest&);
+    using AsyncStub   = std::remove_pointer_t<decltype(std::declval<TStub&>().async())>;
+    using ReaderFunc  = void (AsyncStub::*)(grpc::ClientContext*, const TRequest*, grpc::ClientReadReactor<TProtoMsg>*);
     using ConvertFunc = std::function<Error(const TProtoMsg&, TAosType&)>;
     using NotifyFunc  = std::function<void(TListener&, const TAosType&)>;
+    using StateFunc   = std::function<void(bool connected)>;
 
     /**
      * Constructor.
      *
      * @param stub gRPC service stub.
      * @param request Subscription request.
-     * @param readerFunc Pointer to stub's subscription method.
+     * @param readerFunc Pointer to stub's async subscription method.
      * @param convertFunc Function to convert proto message to AOS type.
      * @param notifyFunc Pointer to listener's notification method.
      * @param logContext Context string for logging.
@@ -113,7 +121,7 @@ public:
 
             mSubscribers.erase(&listener);
 
-            shouldStop = mSubscribers.empty() && mThread.joinable();
+            shouldStop = mSubscribers.empty() && mStarted;
         }
 
         if (shouldStop) {
@@ -123,6 +131,21 @@ public:
         return shouldStop;
     }
 
+    /**
+     * Sets stream state handler.
+     * The handler is called from the gRPC callback thread when the server confirms the stream (initial metadata or
+     * first message is received) and when the confirmed stream is closed, so the caller can detect windows where
+     * notifications may have been missed. Calls are serialized and always alternate: connected, disconnected.
+     *
+     * @param stateFunc stream state handler.
+     */
+    void SetStateHandler(StateFunc stateFunc)
+    {
+        std::lock_guard lock {mMutex};
+
+        mStateFunc = std::move(stateFunc);
+    }
+
     /**
      * Explicitly closes the subscription manager and stops the task.
      * Safe to call multiple times. Should be called before the stub becomes invalid.
@@ -153,123 +176,219 @@ public:
     }
 
 private:
+    class Reactor : public grpc::ClientReadReactor<TProtoMsg> {
+    public:
+        Reactor(GRPCSubscriptionManager& manager, const TRequest& request, uint64_t generation)
+            : mManager(manager)
+            , mRequest(request)
+            , mGeneration(generation)
+        {
+        }
+
+        void Start(TStub* stub, ReaderFunc readerFunc)
+        {
+            (stub->async()->*readerFunc)(&mCtx, &mRequest, this);
+
+            this->StartRead(&mMsg);
+            this->StartCall();
+        }
+
+        void Cancel() { mCtx.TryCancel(); }
+
+        void OnReadInitialMetadataDone(bool ok) override
+        {
+            if (ok) {
+                mManager.SetConnected(mGeneration, true);
+            }
+        }
+
+        void OnReadDone(bool ok) override
+        {
+            if (!ok) {
+                return;
+            }
+
+            // Server may send initial metadata together with the first message.
+            mManager.SetConnected(mGeneration, true);
+            mManager.OnMessage(mMsg);
+
+            this->StartRead(&mMsg);
+        }
+
+        // Manager deletes the reactor, it must be the last call.
+        void OnDone(const grpc::Status& status) override { mManager.OnDone(mGeneration, status); }
+
+    private:
+        GRPCSubscriptionManager& mManager;
+        TRequest                 mRequest;
+        uint64_t                 mGeneration;
+        grpc::ClientContext      mCtx;
+        TProtoMsg                mMsg;
+    };
+
     void Start()
     {
         LOG_DBG() << "Starting subscription task" << Log::Field("context", mLogContext.c_str());
 
-        mClose  = false;
-        mThread = std::thread(&GRPCSubscriptionManager::RunTask, this);
+        mClose   = false;
+        mStarted = true;
+
+        ScheduleConnect(std::chrono::system_clock::now());
     }
 
     void Stop()
     {
-        {
-            std::lock_guard lock {mMutex};
+        std::unique_lock lock {mMutex};
 
-            if (!mThread.joinable()) {
-                return;
-            }
+        if (!mStarted) {
+            return;
+        }
 
-            LOG_DBG() << "Stopping subscription task" << Log::Field("context", mLogContext.c_str());
+        LOG_DBG() << "Stopping subscription task" << Log::Field("context", mLogContext.c_str());
 
-            mClose = true;
+        mClose = true;
 
-            if (mCtx) {
-                mCtx->TryCancel();
-            }
+        if (mReactor) {
+            mReactor->Cancel();
         }
 
-        mCV.notify_all();
-
-        if (mThread.joinable()) {
-            mThread.join();
+        if (mAlarm) {
+            mAlarm->Cancel();
         }
+
+        mCV.wait(lock, [this]() { return !mReactor && mPendingAlarms == 0; });
+
+        mAlarm.reset();
+        mStarted = false;
     }
 
-    void RunTask()
+    // Should be called with locked mMutex.
+    void ScheduleConnect(std::chrono::system_clock::time_point deadline)
     {
-        LOG_DBG() << "Subscription task started" << Log::Field("context", mLogContext.c_str());
+        mPendingAlarms++;
 
-        while (true) {
-            try {
-                ReaderPtr reader;
+        mAlarm = std::make_unique<grpc::Alarm>();
+        mAlarm->Set(deadline, [this](bool ok) { OnConnect(ok); });
+    }
 
-                {
-                    std::lock_guard lock {mMutex};
+    void OnConnect(bool ok)
+    {
+        Reactor* reactor {};
 
-                    if (mClose) {
-                        break;
-                    }
+        {
+            std::lock_guard lock {mMutex};
 
-                    mCtx   = std::make_unique<grpc::ClientContext>();
-                    reader = (mStub->*mReaderFunc)(mCtx.get(), mRequest);
-                }
+            if (ok && !mClose) {
+                LOG_DBG() << "Open subscription stream" << Log::Field("context", mLogContext.c_str());
 
-                TProtoMsg protoMsg;
+                mReactor = std::make_unique<Reactor>(*this, mRequest, ++mGeneration);
+                reactor  = mReactor.get();
+            }
+        }
 
-                while (reader->Read(&protoMsg)) {
-                    auto                           aosType = std::make_unique<TAosType>();
-                    std::unordered_set<TListener*> tmpSubscribers;
+        // Connected state is reported by the reactor once the server confirms the stream.
+        if (reactor) {
+            reactor->Start(mStub, mReaderFunc);
+        }
 
-                    {
-                        std::lock_guard lock {mMutex};
+        std::lock_guard lock {mMutex};
 
-                        LOG_DBG() << "Received message on subscription" << Log::Field("context", mLogContext.c_str());
+        // Notify under the lock: the manager may be destroyed as soon as the lock is released.
+        mPendingAlarms--;
+        mCV.notify_all();
+    }
 
-                        if (auto err = mConvertFunc(protoMsg, *aosType); !err.IsNone()) {
-                            LOG_ERR() << "Conversion failed" << Log::Field("context", mLogContext.c_str())
-                                      << Log::Field(err);
+    // State changes are serialized by mStateMutex and filtered by generation: a stale stream can't report its state
+    // after a newer one, and disconnected is reported only for a stream that was reported connected.
+    void SetConnected(uint64_t generation, bool connected)
+    {
+        std::lock_guard stateLock {mStateMutex};
+        StateFunc       stateFunc;
 
-                            continue;
-                        }
+        {
+            std::lock_guard lock {mMutex};
 
-                        tmpSubscribers = mSubscribers;
-                    }
+            if (generation != mGeneration || connected == mConnected) {
+                return;
+            }
 
-                    for (auto subscriber : tmpSubscribers) {
-                        mNotifyFunc(*subscriber, *aosType);
-                    }
-                }
+            mConnected = connected;
+            stateFunc  = mStateFunc;
+        }
 
-                if (auto status = reader->Finish(); !status.ok()) {
-                    LOG_WRN() << "Stream finished with error" << Log::Field("context", mLogContext.c_str())
-                              << Log::Field("error", status.error_message().c_str());
-                } else {
-                    LOG_DBG() << "Stream finished successfully" << Log::Field("context", mLogContext.c_str());
-                }
-            } catch (const std::exception& e) {
-                LOG_ERR() << "Subscription loop failed" << Log::Field("context", mLogContext.c_str())
-                          << Log::Field(Error {ErrorEnum::eRuntime, e.what()});
-            }
+        if (stateFunc) {
+            stateFunc(connected);
+        }
+    }
 
-            {
-                std::unique_lock lock {mMutex};
+    void OnMessage(const TProtoMsg& protoMsg)
+    {
+        auto                           aosType = std::make_unique<TAosType>();
+        std::unordered_set<TListener*> tmpSubscribers;
+
+        {
+            std::lock_guard lock {mMutex};
+
+            LOG_DBG() << "Received message on subscription" << Log::Field("context", mLogContext.c_str());
 
-                mCV.wait_for(lock, cReconnectInterval, [this]() { return mClose; });
+            if (auto err = mConvertFunc(protoMsg, *aosType); !err.IsNone()) {
+                LOG_ERR() << "Conversion failed" << Log::Field("context", mLogContext.c_str()) << Log::Field(err);
 
-                if (mClose) {
-                    break;
-                }
+                return;
             }
+
+            tmpSubscribers = mSubscribers;
         }
 
-        LOG_DBG() << "Subscription task stopped" << Log::Field("context", mLogContext.c_str());
+        for (auto subscriber : tmpSubscribers) {
+            mNotifyFunc(*subscriber, *aosType);
+        }
+    }
+
+    void OnDone(uint64_t generation, const grpc::Status& status)
+    {
+        if (!status.ok()) {
+            LOG_WRN() << "Stream finished with error" << Log::Field("context", mLogContext.c_str())
+                      << Log::Field("error", status.error_message().c_str());
+        } else {
+            LOG_DBG() << "Stream finished successfully" << Log::Field("context", mLogContext.c_str());
+        }
+
+        SetConnected(generation, false);
+
+        // Reactor is released after the lock: the manager may be destroyed as soon as the lock is released.
+        std::unique_ptr<Reactor> reactor;
+        std::lock_guard          lock {mMutex};
+
+        reactor = std::move(mReactor);
+
+        if (!mClose) {
+            ScheduleConnect(std::chrono::system_clock::now() + cReconnectInterval);
+        }
+
+        mCV.notify_all();
     }
 
     static constexpr auto cReconnectInterval = std::chrono::seconds(3);
 
-    TStub*                               mStub;
-    TRequest                             mRequest;
-    ReaderFunc                           mReaderFunc;
-    ConvertFunc                          mConvertFunc;
-    NotifyFunc                           mNotifyFunc;
-    std::string                          mLogContext;
-    std::mutex                           mMutex;
-    std::condition_variable              mCV;
-    std::unordered_set<TListener*>       mSubscribers;
-    std::unique_ptr<grpc::ClientContext> mCtx;
-    std::thread                          mThread;
-    bool                                 mClose {false};
+    TStub*                         mStub;
+    TRequest                       mRequest;
+    ReaderFunc                     mReaderFunc;
+    ConvertFunc                    mConvertFunc;
+    NotifyFunc                     mNotifyFunc;
+    StateFunc                      mStateFunc;
+    std::string                    mLogContext;
+    std::mutex                     mMutex;
+    std::mutex                     mStateMutex;
+    std::condition_variable        mCV;
+    std::unordered_set<TListener*> mSubscribers;
+    std::unique_ptr<Reactor>       mReactor;
+    std::unique_ptr<grpc::Alarm>   mAlarm;
+    size_t                         mPendingAlarms {};
+    uint64_t                       mGeneration {};
+    bool                           mConnected {false};
+    bool                           mStarted {false};
+    bool                           mClose {false};
 };
 
 } // namespace aos::common::utils
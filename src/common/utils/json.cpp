@@ -6,17 +6,52 @@
  */
 
 #include <algorithm>
-#include <fstream>
-#include <sstream>
+#include <istream>
+#include <ostream>
+#include <strings.h>
 
 #include <Poco/JSON/JSONException.h>
 #include <Poco/JSON/Parser.h>
 
 #include "exception.hpp"
+#include "filesystem.hpp"
 #include "json.hpp"
 
 namespace aos::common::utils {
 
+namespace {
+
+// Appends stream output directly to the string to avoid copying it out of std::ostringstream.
+class StringStreamBuf : public std::streambuf {
+public:
+    explicit StringStreamBuf(std::string& buffer)
+        : mBuffer(buffer)
+    {
+    }
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            mBuffer.push_back(traits_type::to_char_type(ch));
+        }
+
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize size) override
+    {
+        mBuffer.append(data, static_cast<size_t>(size));
+
+        return size;
+    }
+
+private:
+    std::string& mBuffer;
+};
+
+} // namespace
+
 std::string ToStdString(const String& str)
 {
     return str.CStr();
@@ -25,11 +60,6 @@ std::string ToStdString(const String& str)
 CaseInsensitiveObjectWrapper::CaseInsensitiveObjectWrapper(const Poco::JSON::Object::Ptr& object)
     : mObject(object)
 {
-    for (const auto& pair : *object) {
-        if (!pair.second.isEmpty()) {
-            mKeyMap.emplace(ToLowercase(pair.first), pair.first);
-        }
-    }
 }
 
 CaseInsensitiveObjectWrapper::CaseInsensitiveObjectWrapper(const Poco::Dynamic::Var& var)
@@ -39,21 +69,18 @@ CaseInsensitiveObjectWrapper::CaseInsensitiveObjectWrapper(const Poco::Dynamic::
 
 bool CaseInsensitiveObjectWrapper::Has(const std::string& key) const
 {
-    std::string lowerKey = ToLowercase(key);
-
-    return mKeyMap.count(lowerKey) > 0;
+    return Find(key) != nullptr;
 }
 
 Poco::Dynamic::Var CaseInsensitiveObjectWrapper::Get(const std::string& key) const
 {
-    std::string lowerKey = ToLowercase(key);
-    auto        it       = mKeyMap.find(lowerKey);
+    const auto* value = Find(key);
 
-    if (it == mKeyMap.end()) {
+    if (!value) {
         throw Poco::NotFoundException("Key not found");
     }
 
-    return mObject->get(it->second);
+    return *value;
 }
 
 Poco::JSON::Array::Ptr CaseInsensitiveObjectWrapper::GetArray(const std::string& key) const
@@ -82,13 +109,19 @@ CaseInsensitiveObjectWrapper CaseInsensitiveObjectWrapper::GetObject(const std::
     return CaseInsensitiveObjectWrapper(value.extract<Poco::JSON::Object::Ptr>());
 }
 
-std::string CaseInsensitiveObjectWrapper::ToLowercase(const std::string& str) const
+const Poco::Dynamic::Var* CaseInsensitiveObjectWrapper::Find(const std::string& key) const
 {
-    std::string lowerStr = str;
-
-    std::transform(lowerStr.begin(), lowerStr.end(), lowerStr.begin(), ::tolower);
+    // Objects are small, a linear scan is cheaper than building a lowercase key index for each wrapped object.
+    auto it = std::find_if(mObject->begin(), mObject->end(), [&key](const auto& pair) {
+        return !pair.second.isEmpty() && pair.first.size() == key.size()
+            && strncasecmp(pair.first.c_str(), key.c_str(), key.size()) == 0;
+    });
+
+    if (it == mObject->end()) {
+        return nullptr;
+    }
 
-    return lowerStr;
+    return &it->second;
 }
 
 aos::RetWithError<Poco::Dynamic::Var> ParseJson(const std::string& json) noexcept
@@ -119,17 +152,18 @@ aos::RetWithError<Poco::Dynamic::Var> ParseJson(std::istream& in) noexcept
 
 Error WriteJsonToFile(const Poco::JSON::Object::Ptr& json, const std::string& path)
 {
-    std::ofstream file(path);
-    if (!file.is_open()) {
-        return Error(ErrorEnum::eFailed, "Failed to open file");
-    }
+    std::string content;
 
     try {
-        Poco::JSON::Stringifier::stringify(json, file);
+        Stringify(json, content);
     } catch (const std::exception& e) {
         return AOS_ERROR_WRAP(ToAosError(e, ErrorEnum::eInvalidArgument));
     }
 
+    if (auto err = WriteFileAtomically(path, content); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
     return ErrorEnum::eNone;
 }
 
@@ -159,11 +193,19 @@ Poco::Dynamic::Var FindByPath(const Poco::Dynamic::Var object, const std::vector
 
 std::string Stringify(const Poco::Dynamic::Var& json)
 {
-    std::ostringstream oss;
+    std::string buffer;
+
+    Stringify(json, buffer);
 
-    Poco::JSON::Stringifier::stringify(json, oss);
+    return buffer;
+}
+
+void Stringify(const Poco::Dynamic::Var& json, std::string& buffer)
+{
+    StringStreamBuf streamBuf(buffer);
+    std::ostream    stream(&streamBuf);
 
-    return oss.str();
+    Poco::JSON::Stringifier::stringify(json, stream);
 }
 
 } // namespace aos::common::utils
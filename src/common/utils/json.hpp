@@ -10,7 +10,6 @@
 
 #include <optional>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include <Poco/Dynamic/Var.h>
@@ -66,6 +65,9 @@ Poco::Dynamic::Var FindByPath(const Poco::Dynamic::Var object, const std::vector
 
 /**
  * Wrapper for Poco::JSON::Object::Ptr with case-insensitive keys.
+ *
+ * Keys are matched by scanning the object properties, so wrapping and lookups don't allocate. Properties with null
+ * values are treated as absent.
  */
 class CaseInsensitiveObjectWrapper {
 public:
@@ -109,8 +111,8 @@ public:
     template <typename T>
     T GetValue(const std::string& key, const T& defaultValue = T {}) const
     {
-        if (Has(key)) {
-            return Get(key).convert<T>();
+        if (const auto* value = Find(key); value) {
+            return value->convert<T>();
         }
 
         return defaultValue;
@@ -125,8 +127,8 @@ public:
     template <typename T>
     std::optional<T> GetOptionalValue(const std::string& key) const
     {
-        if (Has(key)) {
-            return Get(key).convert<T>();
+        if (const auto* value = Find(key); value) {
+            return value->convert<T>();
         }
 
         return std::nullopt;
@@ -163,10 +165,9 @@ public:
     CaseInsensitiveObjectWrapper GetObject(const std::string& key) const;
 
 private:
-    std::string ToLowercase(const std::string& str) const;
+    const Poco::Dynamic::Var* Find(const std::string& key) const;
 
-    Poco::JSON::Object::Ptr                      mObject;
-    std::unordered_map<std::string, std::string> mKeyMap;
+    Poco::JSON::Object::Ptr mObject;
 };
 
 /**
@@ -253,6 +254,14 @@ Poco::JSON::Array::Ptr ToJsonArray(const Container& container, ConverterFunc con
  */
 std::string Stringify(const Poco::Dynamic::Var& json);
 
+/**
+ * Stringifies json appending the result to the buffer.
+ *
+ * @param json json object.
+ * @param[out] buffer output buffer.
+ */
+void Stringify(const Poco::Dynamic::Var& json, std::string& buffer);
+
 } // namespace aos::common::utils
 
 #endif
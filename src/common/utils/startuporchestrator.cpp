@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include <core/common/tools/logger.hpp>
+
+#include "exception.hpp"
+#include "startuporchestrator.hpp"
+
+namespace aos::common::utils {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+uint64_t ToMilliseconds(std::chrono::microseconds duration)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+StartupOrchestrator::StartupOrchestrator(const std::string& name, size_t maxThreads)
+    : mName(name)
+    , mMaxThreads(std::max<size_t>(maxThreads, 1))
+{
+}
+
+Error StartupOrchestrator::AddStep(const std::string& name, Step step, const std::vector<std::string>& dependencies)
+{
+    auto findStep = [this](const std::string& name) {
+        return std::find_if(
+            mSteps.begin(), mSteps.end(), [&name](const StepInfo& stepInfo) { return stepInfo.mName == name; });
+    };
+
+    if (findStep(name) != mSteps.end()) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eAlreadyExist, "step already exists"));
+    }
+
+    // Dependencies are resolved before the step is added, so the steps graph can't have cycles.
+    std::vector<size_t> dependencyIndexes;
+
+    for (const auto& dependency : dependencies) {
+        auto it = findStep(dependency);
+        if (it == mSteps.end()) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "step dependency not found"));
+        }
+
+        dependencyIndexes.push_back(static_cast<size_t>(it - mSteps.begin()));
+    }
+
+    for (auto index : dependencyIndexes) {
+        mSteps[index].mDependents.push_back(mSteps.size());
+    }
+
+    mSteps.push_back({name, std::move(step), dependencyIndexes.size(), {}});
+
+    return ErrorEnum::eNone;
+}
+
+Error StartupOrchestrator::Run()
+{
+    LOG_DBG() << "Run startup steps" << Log::Field("name", mName.c_str()) << Log::Field("count", mSteps.size());
+
+    mNumPending.clear();
+    mReadySteps.clear();
+    mTimings.clear();
+
+    mNumFinished = 0;
+    mError       = ErrorEnum::eNone;
+    mStartTime   = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < mSteps.size(); i++) {
+        mNumPending.push_back(mSteps[i].mNumDependencies);
+
+        if (mSteps[i].mNumDependencies == 0) {
+            mReadySteps.push_back(i);
+        }
+    }
+
+    std::vector<std::thread> threads;
+
+    for (size_t i = 1; i < std::min(mMaxThreads, mSteps.size()); i++) {
+        threads.emplace_back(&StartupOrchestrator::RunSteps, this);
+    }
+
+    RunSteps();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    mTotalTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mStartTime);
+
+    return mError;
+}
+
+void StartupOrchestrator::LogTimings() const
+{
+    LOG_INF() << "Startup timings" << Log::Field("name", mName.c_str())
+              << Log::Field("totalMs", ToMilliseconds(mTotalTime));
+
+    for (const auto& timing : mTimings) {
+        LOG_INF() << "Startup step" << Log::Field("name", timing.mName.c_str())
+                  << Log::Field("startMs", ToMilliseconds(timing.mStart))
+                  << Log::Field("durationMs", ToMilliseconds(timing.mDuration));
+    }
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+void StartupOrchestrator::RunSteps()
+{
+    std::unique_lock lock {mMutex};
+
+    while (true) {
+        mCondVar.wait(
+            lock, [this]() { return !mReadySteps.empty() || !mError.IsNone() || mNumFinished == mSteps.size(); });
+
+        if (!mError.IsNone() || mNumFinished == mSteps.size()) {
+            return;
+        }
+
+        auto index = mReadySteps.front();
+
+        mReadySteps.pop_front();
+
+        const auto& stepInfo = mSteps[index];
+
+        lock.unlock();
+
+        Error err;
+        auto  start = std::chrono::steady_clock::now();
+
+        try {
+            err = stepInfo.mStep();
+        } catch (const std::exception& e) {
+            err = AOS_ERROR_WRAP(ToAosError(e));
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        lock.lock();
+
+        mTimings.push_back({stepInfo.mName, std::chrono::duration_cast<std::chrono::microseconds>(start - mStartTime),
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start)});
+
+        mNumFinished++;
+
+        if (!err.IsNone()) {
+            LOG_ERR() << "Startup step failed" << Log::Field("name", stepInfo.mName.c_str()) << Log::Field(err);
+
+            if (mError.IsNone()) {
+                mError = err;
+            }
+        } else {
+            for (auto dependent : stepInfo.mDependents) {
+                if (--mNumPending[dependent] == 0) {
+                    mReadySteps.push_back(dependent);
+                }
+            }
+        }
+
+        mCondVar.notify_all();
+    }
+}
+
+} // namespace aos::common::utils
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_COMMON_UTILS_STARTUPORCHESTRATOR_HPP_
+#define AOS_COMMON_UTILS_STARTUPORCHESTRATOR_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <core/common/tools/error.hpp>
+
+namespace aos::common::utils {
+
+/**
+ * Startup step timing.
+ */
+struct StartupTiming {
+    std::string               mName;
+    std::chrono::microseconds mStart;
+    std::chrono::microseconds mDuration;
+};
+
+/**
+ * Runs startup steps concurrently respecting dependencies between them.
+ */
+class StartupOrchestrator {
+public:
+    using Step = std::function<Error()>;
+
+    static constexpr size_t cDefaultMaxThreads = 4;
+
+    /**
+     * Constructor.
+     *
+     * @param name orchestrator name used in logs.
+     * @param maxThreads max number of concurrently running steps.
+     */
+    explicit StartupOrchestrator(const std::string& name, size_t maxThreads = cDefaultMaxThreads);
+
+    /**
+     * Adds startup step. Dependencies should be added before the step.
+     *
+     * @param name step name.
+     * @param step step function.
+     * @param dependencies names of steps which should be finished before the step is started.
+     * @return Error.
+     */
+    Error AddStep(const std::string& name, Step step, const std::vector<std::string>& dependencies = {});
+
+    /**
+     * Runs added steps. No new steps are started after a step fails, already running steps are awaited.
+     *
+     * @return Error of the first failed step.
+     */
+    Error Run();
+
+    /**
+     * Returns timings of finished steps in the order of completion.
+     *
+     * @return const std::vector<StartupTiming>&.
+     */
+    const std::vector<StartupTiming>& GetTimings() const { return mTimings; }
+
+    /**
+     * Logs timings of finished steps.
+     */
+    void LogTimings() const;
+
+private:
+    struct StepInfo {
+        std::string         mName;
+        Step                mStep;
+        size_t              mNumDependencies {};
+        std::vector<size_t> mDependents;
+    };
+
+    void RunSteps();
+
+    std::string                           mName;
+    size_t                                mMaxThreads;
+    std::vector<StepInfo>                 mSteps;
+    std::mutex                            mMutex;
+    std::condition_variable               mCondVar;
+    std::vector<size_t>                   mNumPending;
+    std::deque<size_t>                    mReadySteps;
+    size_t                                mNumFinished {};
+    Error                                 mError;
+    std::vector<StartupTiming>            mTimings;
+    std::chrono::steady_clock::time_point mStartTime;
+    std::chrono::microseconds             mTotalTime {};
+};
+
+} // namespace aos::common::utils
+
+#endif
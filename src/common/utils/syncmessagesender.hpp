@@ -10,10 +10,13 @@
 #include <algorithm>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
+#include <future>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <utility>
-#include <vector>
 
 #include <grpcpp/support/sync_stream.h>
 
@@ -23,18 +26,17 @@
 
 namespace aos::common::utils {
 
-/**
- * Message structure for synchronous communication.
- */
-template <typename Response>
-struct SyncMessage {
-    Response* mResponse {};
-    bool      mResponseReceived {};
-};
-
 /**
  * Synchronous message sender over gRPC streams.
  *
+ * Responses carry no request ID, so they are matched by type: each registered response handler keeps a FIFO queue of
+ * requests waiting for its response type and delivers responses in the order requests were written to the stream.
+ * Many requests may be outstanding at the same time, each waiter is woken individually.
+ *
+ * A timed out request keeps its place in the queue for one more timeout period, so its late response is dropped instead
+ * of being delivered to the next request. New requests of the same type are not written until such late responses are
+ * received or expired, so a response that never arrives doesn't shift responses of the following requests.
+ *
  * @tparam Request request message type.
  * @tparam Response outgoing message type.
  */
@@ -51,6 +53,10 @@ public:
     void Init(grpc::ServerReaderWriter<Request, Response>* stream, std::mutex& writeMutex,
         std::chrono::seconds timeout = std::chrono::seconds(5))
     {
+        Cancel();
+
+        std::lock_guard lock {mMutex};
+
         mStream     = stream;
         mWriteMutex = &writeMutex;
         mTimeout    = timeout;
@@ -66,63 +72,111 @@ public:
      */
     Error SendSync(const Request& request, Response& response)
     {
-        if (!mStream) {
-            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "stream not initialized"));
-        }
+        auto waiter = std::make_shared<Waiter>();
+        auto future = waiter->mPromise.get_future();
 
-        SyncMessage<Response> msg;
+        waiter->mResponse = &response;
 
-        msg.mResponse = &response;
+        ResponseHandler* handler {};
 
         {
             std::lock_guard lock {mMutex};
 
-            mMessages.push_back(&msg);
+            if (!mStream) {
+                return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "stream not initialized"));
+            }
+
+            auto it = std::find_if(mResponseHandlers.begin(), mResponseHandlers.end(),
+                [&response](const ResponseHandler& handler) { return handler.mCheckFunc(response); });
+            if (it == mResponseHandlers.end()) {
+                return AOS_ERROR_WRAP(Error(ErrorEnum::eNotSupported, "no response handler"));
+            }
+
+            handler = &*it;
         }
 
-        // Use the shared write mutex so that SendSync and SendMessage never
-        // call mStream->Write() concurrently (gRPC forbids concurrent writes).
-        {
+        // Queue the waiter and write the request under the shared write mutex: the queue order must match the order
+        // of requests on the stream. It also guarantees that mStream->Write() is never called concurrently.
+        while (true) {
+            {
+                std::unique_lock lock {mMutex};
+
+                WaitTimedOutWaiters(lock, *handler);
+            }
+
             std::lock_guard writeLock {*mWriteMutex};
 
+            {
+                std::lock_guard lock {mMutex};
+
+                // Other request may time out while the write mutex is taken.
+                if (HasTimedOutWaiters(*handler)) {
+                    continue;
+                }
+
+                handler->mWaiters.push_back(waiter);
+            }
+
             if (!mStream->Write(request)) {
                 std::lock_guard lock {mMutex};
 
-                EraseMessage(&msg);
+                EraseWaiter(*handler, waiter);
 
                 return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "failed to send message"));
             }
-        }
 
-        {
-            std::unique_lock lock {mMutex};
+            break;
+        }
 
-            // Receiving the message.
-            mCondVar.wait_for(lock, mTimeout, [&msg] { return msg.mResponseReceived; });
+        if (future.wait_for(mTimeout) != std::future_status::ready) {
+            std::lock_guard lock {mMutex};
 
-            EraseMessage(&msg);
+            // Response may be delivered right after wait timeout.
+            if (future.wait_for(std::chrono::seconds::zero()) != std::future_status::ready) {
+                waiter->mResponse = nullptr;
+                waiter->mExpireAt = std::chrono::steady_clock::now() + mTimeout;
 
-            if (!msg.mResponseReceived) {
                 return AOS_ERROR_WRAP(Error(ErrorEnum::eTimeout, "response timeout"));
             }
         }
 
+        if (auto err = future.get(); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
         return ErrorEnum::eNone;
     }
 
+    /**
+     * Cancels all pending requests.
+     */
+    void Cancel()
+    {
+        std::lock_guard lock {mMutex};
+
+        for (auto& handler : mResponseHandlers) {
+            for (auto& waiter : handler.mWaiters) {
+                waiter->mPromise.set_value(Error(ErrorEnum::eCanceled, "request canceled"));
+            }
+
+            handler.mWaiters.clear();
+        }
+
+        mCondVar.notify_all();
+    }
+
     /**
      * Registers a message processing handler.
      *
      * @param checkFunc function to check if the Response matches the handler criteria.
      * @param copyFunc function to copy data from source Response to destination Response.
-     * @param strict if true, ProcessResponse returs error if none of the input messages matches response.
      */
     void RegisterResponseHandler(
         std::function<bool(const Response&)> checkFunc, std::function<void(const Response&, Response&)> copyFunc)
     {
         std::lock_guard lock {mMutex};
 
-        mResponseHandlers.emplace_back(ResponseHandler {std::move(checkFunc), std::move(copyFunc)});
+        mResponseHandlers.emplace_back(ResponseHandler {std::move(checkFunc), std::move(copyFunc), {}});
     }
 
     /**
@@ -135,54 +189,99 @@ public:
     {
         std::lock_guard lock {mMutex};
 
-        for (auto& handler : mResponseHandlers) {
-            // Check if this handler matches the incoming message
-            if (!handler.mCheckFunc(outputMessage)) {
-                continue;
-            }
+        auto handler = std::find_if(mResponseHandlers.begin(), mResponseHandlers.end(),
+            [&outputMessage](const ResponseHandler& handler) { return handler.mCheckFunc(outputMessage); });
+        if (handler == mResponseHandlers.end()) {
+            return Optional<Error>();
+        }
 
-            // Find waiting messages that match and copy the response
-            for (auto* msg : mMessages) {
-                if (!msg->mResponse || !handler.mCheckFunc(*msg->mResponse)) {
-                    continue;
-                }
+        RemoveExpiredWaiters(*handler);
 
-                try {
-                    handler.mCopyFunc(outputMessage, *msg->mResponse);
-                    msg->mResponseReceived = true;
-                    mCondVar.notify_all();
+        if (handler->mWaiters.empty()) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "no matching request found"));
+        }
 
-                    return Error();
-                } catch (const std::exception& e) {
-                    return AOS_ERROR_WRAP(ToAosError(e));
-                }
-            }
+        auto waiter = std::move(handler->mWaiters.front());
 
-            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "no matching request found"));
+        handler->mWaiters.pop_front();
+
+        if (!waiter->mResponse) {
+            mCondVar.notify_all();
+
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eTimeout, "late response of timed out request dropped"));
+        }
+
+        try {
+            handler->mCopyFunc(outputMessage, *waiter->mResponse);
+        } catch (const std::exception& e) {
+            auto err = AOS_ERROR_WRAP(ToAosError(e));
+
+            waiter->mPromise.set_value(err);
+
+            return err;
         }
 
-        return Optional<Error>();
+        waiter->mPromise.set_value(Error());
+
+        return Error();
     }
 
 private:
+    // Timed out waiter has no response and is kept until its late response is received or expire time is reached.
+    struct Waiter {
+        Response*                             mResponse {};
+        std::promise<Error>                   mPromise;
+        std::chrono::steady_clock::time_point mExpireAt;
+    };
+
     struct ResponseHandler {
         std::function<bool(const Response&)>            mCheckFunc;
         std::function<void(const Response&, Response&)> mCopyFunc;
+        std::deque<std::shared_ptr<Waiter>>             mWaiters;
     };
 
-    void EraseMessage(SyncMessage<Response>* msg)
+    void EraseWaiter(ResponseHandler& handler, const std::shared_ptr<Waiter>& waiter)
+    {
+        auto it = std::find(handler.mWaiters.begin(), handler.mWaiters.end(), waiter);
+        if (it != handler.mWaiters.end()) {
+            handler.mWaiters.erase(it);
+        }
+    }
+
+    static bool IsTimedOut(const std::shared_ptr<Waiter>& waiter) { return !waiter->mResponse; }
+
+    static void RemoveExpiredWaiters(ResponseHandler& handler)
     {
-        auto it = std::find(mMessages.begin(), mMessages.end(), msg);
-        if (it != mMessages.end()) {
-            mMessages.erase(it);
+        auto now = std::chrono::steady_clock::now();
+
+        auto isExpired = [now](const std::shared_ptr<Waiter>& waiter) {
+            return IsTimedOut(waiter) && waiter->mExpireAt <= now;
+        };
+
+        handler.mWaiters.erase(
+            std::remove_if(handler.mWaiters.begin(), handler.mWaiters.end(), isExpired), handler.mWaiters.end());
+    }
+
+    static bool HasTimedOutWaiters(ResponseHandler& handler)
+    {
+        RemoveExpiredWaiters(handler);
+
+        return std::any_of(handler.mWaiters.begin(), handler.mWaiters.end(), IsTimedOut);
+    }
+
+    void WaitTimedOutWaiters(std::unique_lock<std::mutex>& lock, ResponseHandler& handler)
+    {
+        while (HasTimedOutWaiters(handler)) {
+            auto it = std::find_if(handler.mWaiters.begin(), handler.mWaiters.end(), IsTimedOut);
+
+            mCondVar.wait_until(lock, (*it)->mExpireAt);
         }
     }
 
     grpc::ServerReaderWriter<Request, Response>* mStream {};
     std::mutex*                                  mWriteMutex {};
     std::chrono::seconds                         mTimeout {5};
-    std::vector<SyncMessage<Response>*>          mMessages;
-    std::vector<ResponseHandler>                 mResponseHandlers;
+    std::list<ResponseHandler>                   mResponseHandlers;
     std::mutex                                   mMutex;
     std::condition_variable                      mCondVar;
 };
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <common/utils/exec.hpp>
+
+using namespace testing;
+
+namespace aos::common::utils {
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class ExecTest : public Test {
+protected:
+    void SetUp() override { tests::utils::InitLog(); }
+
+    void TearDown() override { SetMaxConcurrentExecs(cDefaultMaxConcurrentExecs); }
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(ExecTest, ExecCommand)
+{
+    auto [out, err] = ExecCommand({"sh", "-c", "echo stdout; echo stderr >&2"});
+    ASSERT_TRUE(err.IsNone());
+
+    EXPECT_EQ(out, "stdout\nstderr\n");
+}
+
+TEST_F(ExecTest, UnexpectedExitCode)
+{
+    auto [out, err] = ExecCommand({"sh", "-c", "echo failed; exit 3"});
+    EXPECT_TRUE(err.Is(ErrorEnum::eRuntime));
+
+    EXPECT_TRUE(ExecCommand({"sh", "-c", "exit 3"}, {0, 3}).mError.IsNone());
+}
+
+TEST_F(ExecTest, LargeOutput)
+{
+    constexpr auto cOutputSize = 1024 * 1024;
+
+    auto [out, err] = ExecCommand({"head", "-c", std::to_string(cOutputSize), "/dev/zero"});
+    ASSERT_TRUE(err.IsNone());
+
+    EXPECT_EQ(out.size(), cOutputSize);
+}
+
+TEST_F(ExecTest, DetachedGrandchildDoesNotBlock)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    auto [out, err] = ExecCommand({"sh", "-c", "sleep 5 & echo done"});
+    ASSERT_TRUE(err.IsNone());
+
+    EXPECT_EQ(out, "done\n");
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+}
+
+TEST_F(ExecTest, StreamOutput)
+{
+    std::string output;
+    size_t      numChunks = 0;
+
+    auto err = ExecStreamCommand({"sh", "-c", "echo first; sleep 0.1; echo second"}, [&](std::string_view chunk) {
+        output.append(chunk);
+        numChunks++;
+    });
+    ASSERT_TRUE(err.IsNone());
+
+    EXPECT_EQ(output, "first\nsecond\n");
+    EXPECT_EQ(numChunks, 2);
+}
+
+TEST_F(ExecTest, LimitConcurrentCommands)
+{
+    constexpr auto cNumCommands = 4;
+
+    SetMaxConcurrentExecs(1);
+
+    std::atomic_int          numFailed {};
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (auto i = 0; i < cNumCommands; i++) {
+        threads.emplace_back([&numFailed]() {
+            if (!ExecCommand({"sleep", "0.1"}).mError.IsNone()) {
+                numFailed++;
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numFailed, 0);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(cNumCommands * 100));
+}
+
+TEST_F(ExecTest, DetachedCommandIsNotLimited)
+{
+    SetMaxConcurrentExecs(1);
+
+    std::thread thread([]() { EXPECT_TRUE(ExecCommand({"sleep", "0.5"}).mError.IsNone()); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto start = std::chrono::steady_clock::now();
+
+    EXPECT_TRUE(ExecDetachedCommand({"true"}).IsNone());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(300));
+
+    thread.join();
+}
+
+} // namespace aos::common::utils
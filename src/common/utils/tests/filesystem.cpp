@@ -5,9 +5,15 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <fcntl.h>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <limits>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <gtest/gtest.h>
 
@@ -29,8 +35,33 @@ namespace {
 
 constexpr auto cTestDir = "fs_tests";
 
+bool IsCloneSupported(const std::string& dir)
+{
+    const auto src = std::filesystem::path(dir) / "clone_src";
+    const auto dst = std::filesystem::path(dir) / "clone_dst";
+
+    std::ofstream(src) << "content";
+
+    auto srcFd = open(src.c_str(), O_RDONLY | O_CLOEXEC);
+    auto dstFd = open(dst.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    auto res   = srcFd >= 0 && dstFd >= 0 && ioctl(dstFd, FICLONE, srcFd) == 0;
+
+    close(srcFd);
+    close(dstFd);
+
+    std::filesystem::remove(src);
+    std::filesystem::remove(dst);
+
+    return res;
 }
 
+size_t CountDirEntries(const std::string& dir)
+{
+    return std::distance(std::filesystem::directory_iterator(dir), std::filesystem::directory_iterator());
+}
+
+} // namespace
+
 using namespace testing;
 
 /***********************************************************************************************************************
@@ -182,4 +213,113 @@ TEST_F(FSTest, CalculateSizeOverflow)
     EXPECT_GT(size, static_cast<uintmax_t>(std::numeric_limits<int>::max()));
 }
 
+TEST_F(FSTest, CopyFile)
+{
+    const auto src = std::filesystem::path(cTestDir) / "src.bin";
+    const auto dst = std::filesystem::path(cTestDir) / "dst.bin";
+
+    std::string content(3 * 1024 * 1024 + 17, 'a');
+
+    std::ofstream(src, std::ios::binary) << content;
+    std::ofstream(dst, std::ios::binary) << "old content";
+
+    ASSERT_EQ(CopyFile(src.string(), dst.string()), aos::ErrorEnum::eNone);
+
+    std::ifstream file(dst, std::ios::binary);
+
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(file), {}), content);
+    EXPECT_EQ(std::filesystem::hard_link_count(src), 1);
+    EXPECT_FALSE(std::filesystem::exists(dst.string() + ".tmp"));
+}
+
+TEST_F(FSTest, CopyFileAllowHardLink)
+{
+    const auto src = std::filesystem::path(cTestDir) / "src.bin";
+    const auto dst = std::filesystem::path(cTestDir) / "dst.bin";
+
+    std::ofstream(src, std::ios::binary) << "content";
+
+    ASSERT_EQ(CopyFile(src.string(), dst.string(), true), aos::ErrorEnum::eNone);
+
+    std::ifstream file(dst, std::ios::binary);
+
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(file), {}), "content");
+    EXPECT_FALSE(std::filesystem::exists(dst.string() + ".tmp"));
+
+    struct stat srcStat;
+    struct stat dstStat;
+
+    ASSERT_EQ(stat(src.c_str(), &srcStat), 0);
+    ASSERT_EQ(stat(dst.c_str(), &dstStat), 0);
+
+    // Cloned file has its own inode, otherwise the destination is hard linked to the source.
+    if (IsCloneSupported(cTestDir)) {
+        EXPECT_NE(srcStat.st_ino, dstStat.st_ino);
+    } else {
+        EXPECT_EQ(srcStat.st_ino, dstStat.st_ino);
+    }
+}
+
+TEST_F(FSTest, CopyMissingFile)
+{
+    EXPECT_EQ(CopyFile((std::filesystem::path(cTestDir) / "missing").string(),
+                  (std::filesystem::path(cTestDir) / "dst.bin").string()),
+        aos::ErrorEnum::eNotFound);
+}
+
+TEST_F(FSTest, WriteFilesAtomically)
+{
+    const auto file1 = std::filesystem::path(cTestDir) / "file1";
+    const auto file2 = std::filesystem::path(cTestDir) / "file2";
+
+    std::ofstream(file1) << "old content";
+
+    ASSERT_EQ(WriteFilesAtomically({{file1.string(), "content1"}, {file2.string(), "content2"}}),
+        aos::ErrorEnum::eNone);
+
+    for (const auto& [path, content] : {std::pair {file1, "content1"}, std::pair {file2, "content2"}}) {
+        std::ifstream file(path);
+
+        EXPECT_EQ(std::string(std::istreambuf_iterator<char>(file), {}), content);
+    }
+
+    EXPECT_EQ(CountDirEntries(cTestDir), 2);
+}
+
+TEST_F(FSTest, WriteFilesAtomicallyFails)
+{
+    const auto file = std::filesystem::path(cTestDir) / "file";
+
+    std::ofstream(file) << "old content";
+
+    EXPECT_EQ(WriteFilesAtomically({{file.string(), "new content"}, {"/non/existent/path/file", "content"}}),
+        aos::ErrorEnum::eFailed);
+
+    std::ifstream stream(file);
+
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(stream), {}), "old content");
+    EXPECT_EQ(CountDirEntries(cTestDir), 1);
+}
+
+TEST_F(FSTest, WriteFileAtomicallyKeepsMode)
+{
+    const auto existing = std::filesystem::path(cTestDir) / "existing";
+    const auto created  = std::filesystem::path(cTestDir) / "created";
+
+    std::ofstream(existing) << "old content";
+
+    ASSERT_EQ(chmod(existing.c_str(), 0600), 0);
+
+    ASSERT_EQ(WriteFileAtomically(existing.string(), "new content"), aos::ErrorEnum::eNone);
+    ASSERT_EQ(WriteFileAtomically(created.string(), "new content"), aos::ErrorEnum::eNone);
+
+    struct stat fileStat;
+
+    ASSERT_EQ(stat(existing.c_str(), &fileStat), 0);
+    EXPECT_EQ(fileStat.st_mode & 07777, 0600);
+
+    ASSERT_EQ(stat(created.c_str(), &fileStat), 0);
+    EXPECT_EQ(fileStat.st_mode & 07777, 0644);
+}
+
 } // namespace aos::common::utils
@@ -160,6 +160,25 @@ TEST_F(JsonTest, CaseInsensitiveObjectWrapperSucceeds)
     EXPECT_EQ(wrapper.GetOptionalValue<std::string>("key").value(), "value");
 }
 
+TEST_F(JsonTest, CaseInsensitiveObjectWrapperMixedCaseKeys)
+{
+    try {
+        Poco::JSON::Parser parser;
+        auto               result = parser.parse({R"({"unitConfig":{"NodeID":"node1"},"VERSION":"1.0","Empty":null})"});
+
+        CaseInsensitiveObjectWrapper wrapper(result);
+
+        EXPECT_EQ(wrapper.GetValue<std::string>("version"), "1.0");
+        EXPECT_EQ(wrapper.GetObject("UnitConfig").GetValue<std::string>("nodeId"), "node1");
+        EXPECT_FALSE(wrapper.Has("empty"));
+        EXPECT_FALSE(wrapper.Has("versio"));
+        EXPECT_EQ(wrapper.GetValue<std::string>("empty", "default"), "default");
+        EXPECT_THROW(wrapper.Get("empty"), Poco::NotFoundException);
+    } catch (const Poco::Exception& e) {
+        FAIL() << e.displayText();
+    }
+}
+
 TEST_F(JsonTest, CaseInsensitiveObjectWrapperFromPocoVarSucceeds)
 {
     try {
@@ -314,4 +333,18 @@ TEST_F(JsonTest, Stringify)
     EXPECT_EQ(object->get("key").convert<std::string>(), "value");
 }
 
+TEST_F(JsonTest, StringifyToBuffer)
+{
+    Poco::JSON::Object::Ptr object = new Poco::JSON::Object(Poco::JSON_PRESERVE_KEY_ORDER);
+    object->set("key", "value");
+    object->set("array", ToJsonArray(std::vector<int> {1, 2}, [](int value) { return value; }));
+
+    std::string buffer = "prefix:";
+
+    Stringify(object, buffer);
+
+    EXPECT_EQ(buffer, R"(prefix:{"key":"value","array":[1,2]})");
+    EXPECT_EQ(Stringify(object), R"({"key":"value","array":[1,2]})");
+}
+
 } // namespace aos::common::utils
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <common/utils/startuporchestrator.hpp>
+
+using namespace testing;
+
+namespace aos::common::utils {
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class StartupOrchestratorTest : public Test {
+protected:
+    void SetUp() override { tests::utils::InitLog(); }
+
+    size_t IndexOf(const std::vector<StartupTiming>& timings, const std::string& name)
+    {
+        auto it = std::find_if(
+            timings.begin(), timings.end(), [&name](const StartupTiming& timing) { return timing.mName == name; });
+
+        return static_cast<size_t>(it - timings.begin());
+    }
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(StartupOrchestratorTest, RunStepsInDependencyOrder)
+{
+    StartupOrchestrator orchestrator("test");
+
+    auto step = []() { return ErrorEnum::eNone; };
+
+    ASSERT_TRUE(orchestrator.AddStep("a", step).IsNone());
+    ASSERT_TRUE(orchestrator.AddStep("b", step, {"a"}).IsNone());
+    ASSERT_TRUE(orchestrator.AddStep("c", step, {"a"}).IsNone());
+    ASSERT_TRUE(orchestrator.AddStep("d", step, {"b", "c"}).IsNone());
+
+    ASSERT_TRUE(orchestrator.Run().IsNone());
+
+    const auto& timings = orchestrator.GetTimings();
+
+    ASSERT_EQ(timings.size(), 4);
+
+    EXPECT_LT(IndexOf(timings, "a"), IndexOf(timings, "b"));
+    EXPECT_LT(IndexOf(timings, "a"), IndexOf(timings, "c"));
+    EXPECT_LT(IndexOf(timings, "b"), IndexOf(timings, "d"));
+    EXPECT_LT(IndexOf(timings, "c"), IndexOf(timings, "d"));
+
+    orchestrator.LogTimings();
+}
+
+TEST_F(StartupOrchestratorTest, RunIndependentStepsConcurrently)
+{
+    constexpr auto cNumSteps = 3;
+
+    StartupOrchestrator orchestrator("test", cNumSteps);
+    std::atomic_int     numRunning {};
+    std::atomic_int     maxRunning {};
+
+    auto step = [&]() {
+        auto running = ++numRunning;
+
+        maxRunning = std::max(maxRunning.load(), running);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        numRunning--;
+
+        return ErrorEnum::eNone;
+    };
+
+    for (auto i = 0; i < cNumSteps; i++) {
+        ASSERT_TRUE(orchestrator.AddStep(std::to_string(i), step).IsNone());
+    }
+
+    ASSERT_TRUE(orchestrator.Run().IsNone());
+
+    EXPECT_EQ(maxRunning, cNumSteps);
+}
+
+TEST_F(StartupOrchestratorTest, StopOnFailedStep)
+{
+    StartupOrchestrator orchestrator("test");
+
+    auto dependentStarted = false;
+    auto failedStep       = []() { return ErrorEnum::eFailed; };
+    auto dependentStep    = [&dependentStarted]() {
+        dependentStarted = true;
+
+        return ErrorEnum::eNone;
+    };
+
+    ASSERT_TRUE(orchestrator.AddStep("a", failedStep).IsNone());
+    ASSERT_TRUE(orchestrator.AddStep("b", dependentStep, {"a"}).IsNone());
+
+    EXPECT_TRUE(orchestrator.Run().Is(ErrorEnum::eFailed));
+    EXPECT_FALSE(dependentStarted);
+}
+
+TEST_F(StartupOrchestratorTest, AddInvalidStep)
+{
+    StartupOrchestrator orchestrator("test");
+
+    auto step = []() { return ErrorEnum::eNone; };
+
+    ASSERT_TRUE(orchestrator.AddStep("a", step).IsNone());
+
+    EXPECT_TRUE(orchestrator.AddStep("a", step).Is(ErrorEnum::eAlreadyExist));
+    EXPECT_TRUE(orchestrator.AddStep("b", step, {"c"}).Is(ErrorEnum::eNotFound));
+}
+
+} // namespace aos::common::utils
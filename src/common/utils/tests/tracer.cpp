@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <common/utils/json.hpp>
+#include <common/utils/tracer.hpp>
+
+using namespace testing;
+
+namespace aos::common::utils {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+const auto cDumpFile = std::filesystem::temp_directory_path() / "aos_tracer_test.json";
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class TracerTest : public Test {
+protected:
+    void SetUp() override
+    {
+        tests::utils::InitLog();
+
+        Tracer::Get().Clear();
+    }
+
+    void TearDown() override
+    {
+        Tracer::Get().Disable();
+
+        std::filesystem::remove(cDumpFile);
+    }
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(TracerTest, SkipSpansWhenDisabled)
+{
+    {
+        AOS_TRACE_SPAN("test", "span");
+    }
+
+    EXPECT_TRUE(Tracer::Get().GetEvents().empty());
+}
+
+TEST_F(TracerTest, RecordSpans)
+{
+    ASSERT_TRUE(Tracer::Get().Enable().IsNone());
+
+    {
+        AOS_TRACE_SPAN("test", "outer");
+
+        std::thread([]() { AOS_TRACE_SPAN("test", "thread"); }).join();
+
+        AOS_TRACE_FUNCTION("test");
+    }
+
+    auto events = Tracer::Get().GetEvents();
+
+    ASSERT_EQ(events.size(), 3);
+
+    std::map<std::string, TraceEvent> spans;
+
+    for (const auto& event : events) {
+        EXPECT_STREQ(event.mCategory, "test");
+
+        spans[event.mName] = event;
+    }
+
+    ASSERT_EQ(spans.count("outer"), 1);
+    ASSERT_EQ(spans.count("thread"), 1);
+    ASSERT_EQ(spans.count("TestBody"), 1);
+
+    EXPECT_NE(spans["outer"].mThreadID, spans["thread"].mThreadID);
+    EXPECT_EQ(spans["outer"].mThreadID, spans["TestBody"].mThreadID);
+    EXPECT_LE(spans["outer"].mStart, spans["thread"].mStart);
+    EXPECT_GE(spans["outer"].mStart + spans["outer"].mDuration, spans["TestBody"].mStart + spans["TestBody"].mDuration);
+}
+
+TEST_F(TracerTest, KeepLatestEvents)
+{
+    ASSERT_TRUE(Tracer::Get().Enable("", 2).IsNone());
+
+    Tracer::Get().AddEvent("test", "first", 1, 1);
+    Tracer::Get().AddEvent("test", "second", 2, 1);
+    Tracer::Get().AddEvent("test", "third", 3, 1);
+
+    auto events = Tracer::Get().GetEvents();
+
+    ASSERT_EQ(events.size(), 2);
+
+    EXPECT_STREQ(events[0].mName, "second");
+    EXPECT_STREQ(events[1].mName, "third");
+}
+
+TEST_F(TracerTest, DumpOnSignal)
+{
+    ASSERT_TRUE(Tracer::Get().Enable(cDumpFile.string()).IsNone());
+
+    Tracer::Get().AddEvent("test", "span", 10, 20);
+
+    ASSERT_EQ(raise(SIGUSR1), 0);
+
+    for (auto i = 0; i < 100 && !std::filesystem::exists(cDumpFile); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::ifstream file(cDumpFile);
+
+    auto [json, err] = ParseJson(file);
+    ASSERT_TRUE(err.IsNone());
+
+    auto events = json.extract<Poco::JSON::Object::Ptr>()->getArray("traceEvents");
+
+    ASSERT_EQ(events->size(), 1);
+
+    auto event = events->getObject(0);
+
+    EXPECT_EQ(event->getValue<std::string>("name"), "span");
+    EXPECT_EQ(event->getValue<std::string>("ph"), "X");
+    EXPECT_EQ(event->getValue<uint64_t>("ts"), 10);
+    EXPECT_EQ(event->getValue<uint64_t>("dur"), 20);
+}
+
+} // namespace aos::common::utils
@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <core/common/tools/logger.hpp>
+
+#include "json.hpp"
+#include "tracer.hpp"
+
+namespace aos::common::utils {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+std::atomic_bool Tracer::sEnabled {};
+int              Tracer::sSignalPipe[2] = {-1, -1};
+
+namespace {
+
+constexpr char cDumpCmd = 'd';
+constexpr char cStopCmd = 's';
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+Tracer& Tracer::Get()
+{
+    static Tracer sTracer;
+
+    return sTracer;
+}
+
+uint64_t Tracer::Now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+Error Tracer::Enable(const std::string& dumpFile, size_t bufferSize)
+{
+    std::lock_guard lock {mMutex};
+
+    if (IsEnabled()) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eWrongState, "tracing already enabled"));
+    }
+
+    LOG_INF() << "Enable tracing" << Log::Field("dumpFile", dumpFile.c_str()) << Log::Field("bufferSize", bufferSize);
+
+    mBufferSize = std::max<size_t>(bufferSize, 1);
+    mDumpFile   = dumpFile;
+
+    for (auto& buffer : mBuffers) {
+        std::lock_guard bufferLock {buffer->mMutex};
+
+        buffer->mEvents.assign(mBufferSize, {});
+        buffer->mNext  = 0;
+        buffer->mCount = 0;
+    }
+
+    if (!mDumpFile.empty()) {
+        if (auto err = StartDumpThread(); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    sEnabled = true;
+
+    return ErrorEnum::eNone;
+}
+
+void Tracer::Disable()
+{
+    {
+        std::lock_guard lock {mMutex};
+
+        if (!IsEnabled()) {
+            return;
+        }
+
+        LOG_INF() << "Disable tracing";
+
+        sEnabled = false;
+    }
+
+    // Dump thread takes the tracer lock, so it is stopped without holding it.
+    StopDumpThread();
+}
+
+void Tracer::AddEvent(const char* category, const char* name, uint64_t start, uint64_t duration)
+{
+    thread_local ThreadBufferHolder tHolder;
+    thread_local int                tThreadID = gettid();
+
+    if (!tHolder.mBuffer) {
+        tHolder.mBuffer = AcquireThreadBuffer();
+    }
+
+    auto& buffer = *tHolder.mBuffer;
+
+    // The lock is only contended while the trace is being collected.
+    std::lock_guard lock {buffer.mMutex};
+
+    if (buffer.mEvents.empty()) {
+        return;
+    }
+
+    buffer.mEvents[buffer.mNext] = {category, name, start, duration, tThreadID};
+    buffer.mNext                 = (buffer.mNext + 1) % buffer.mEvents.size();
+    buffer.mCount                = std::min(buffer.mCount + 1, buffer.mEvents.size());
+}
+
+std::vector<TraceEvent> Tracer::GetEvents() const
+{
+    std::vector<TraceEvent> events;
+
+    {
+        std::lock_guard lock {mMutex};
+
+        for (const auto& buffer : mBuffers) {
+            std::lock_guard bufferLock {buffer->mMutex};
+
+            auto first = (buffer->mNext + buffer->mEvents.size() - buffer->mCount) % buffer->mEvents.size();
+
+            for (size_t i = 0; i < buffer->mCount; i++) {
+                events.push_back(buffer->mEvents[(first + i) % buffer->mEvents.size()]);
+            }
+        }
+    }
+
+    std::sort(events.begin(), events.end(),
+        [](const TraceEvent& lhs, const TraceEvent& rhs) { return lhs.mStart < rhs.mStart; });
+
+    return events;
+}
+
+std::string Tracer::GetTraceJSON() const
+{
+    return Stringify(Poco::Dynamic::Var(CreateTraceJSON()));
+}
+
+Error Tracer::Dump(const std::string& path) const
+{
+    auto dumpFile = path;
+
+    if (dumpFile.empty()) {
+        std::lock_guard lock {mMutex};
+
+        dumpFile = mDumpFile;
+    }
+
+    if (dumpFile.empty()) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "trace dump file is not set"));
+    }
+
+    if (auto err = WriteJsonToFile(CreateTraceJSON(), dumpFile); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    LOG_INF() << "Trace dumped" << Log::Field("file", dumpFile.c_str());
+
+    return ErrorEnum::eNone;
+}
+
+void Tracer::Clear()
+{
+    std::lock_guard lock {mMutex};
+
+    for (auto& buffer : mBuffers) {
+        std::lock_guard bufferLock {buffer->mMutex};
+
+        buffer->mNext  = 0;
+        buffer->mCount = 0;
+    }
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+Tracer::ThreadBufferHolder::~ThreadBufferHolder()
+{
+    if (!mBuffer) {
+        return;
+    }
+
+    // Keep recorded events, the buffer is reused by the next new thread.
+    std::lock_guard lock {mBuffer->mMutex};
+
+    mBuffer->mInUse = false;
+}
+
+void Tracer::SignalHandler(int sig)
+{
+    (void)sig;
+
+    auto cmd = cDumpCmd;
+
+    // Only async-signal-safe calls are allowed here, the trace is dumped by the dump thread.
+    [[maybe_unused]] auto ret = write(sSignalPipe[1], &cmd, 1);
+}
+
+std::shared_ptr<Tracer::ThreadBuffer> Tracer::AcquireThreadBuffer()
+{
+    std::lock_guard lock {mMutex};
+
+    for (auto& buffer : mBuffers) {
+        std::lock_guard bufferLock {buffer->mMutex};
+
+        if (!buffer->mInUse) {
+            buffer->mInUse = true;
+
+            return buffer;
+        }
+    }
+
+    auto buffer = std::make_shared<ThreadBuffer>();
+
+    buffer->mEvents.resize(mBufferSize);
+    buffer->mInUse = true;
+
+    mBuffers.push_back(buffer);
+
+    return buffer;
+}
+
+Poco::JSON::Object::Ptr Tracer::CreateTraceJSON() const
+{
+    auto pid         = getpid();
+    auto traceEvents = Poco::JSON::Array::Ptr(new Poco::JSON::Array());
+
+    for (const auto& event : GetEvents()) {
+        auto object = Poco::JSON::Object::Ptr(new Poco::JSON::Object());
+
+        object->set("name", event.mName);
+        object->set("cat", event.mCategory);
+        object->set("ph", "X");
+        object->set("ts", event.mStart);
+        object->set("dur", event.mDuration);
+        object->set("pid", pid);
+        object->set("tid", event.mThreadID);
+
+        traceEvents->add(object);
+    }
+
+    auto json = Poco::JSON::Object::Ptr(new Poco::JSON::Object());
+
+    json->set("traceEvents", traceEvents);
+    json->set("displayTimeUnit", "ms");
+
+    return json;
+}
+
+Error Tracer::StartDumpThread()
+{
+    if (pipe2(sSignalPipe, O_CLOEXEC) != 0) {
+        return AOS_ERROR_WRAP(Error(errno, "can't create signal pipe"));
+    }
+
+    struct sigaction act { };
+
+    act.sa_handler = SignalHandler;
+    act.sa_flags   = SA_RESTART;
+
+    if (sigaction(SIGUSR1, &act, nullptr) != 0) {
+        auto err = Error(errno, "can't set signal handler");
+
+        close(sSignalPipe[0]);
+        close(sSignalPipe[1]);
+
+        return AOS_ERROR_WRAP(err);
+    }
+
+    mDumpThread = std::thread(&Tracer::DumpOnSignal, this);
+
+    return ErrorEnum::eNone;
+}
+
+void Tracer::StopDumpThread()
+{
+    if (!mDumpThread.joinable()) {
+        return;
+    }
+
+    signal(SIGUSR1, SIG_DFL);
+
+    auto                  cmd = cStopCmd;
+    [[maybe_unused]] auto ret = write(sSignalPipe[1], &cmd, 1);
+
+    mDumpThread.join();
+
+    close(sSignalPipe[0]);
+    close(sSignalPipe[1]);
+
+    sSignalPipe[0] = -1;
+    sSignalPipe[1] = -1;
+}
+
+void Tracer::DumpOnSignal()
+{
+    char cmd {};
+
+    while (true) {
+        auto ret = read(sSignalPipe[0], &cmd, 1);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (ret <= 0 || cmd == cStopCmd) {
+            return;
+        }
+
+        if (auto err = Dump(); !err.IsNone()) {
+            LOG_ERR() << "Can't dump trace" << Log::Field(err);
+        }
+    }
+}
+
+} // namespace aos::common::utils
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_COMMON_UTILS_TRACER_HPP_
+#define AOS_COMMON_UTILS_TRACER_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Poco/JSON/Object.h>
+
+#include <core/common/tools/error.hpp>
+
+namespace aos::common::utils {
+
+/**
+ * Trace event.
+ */
+struct TraceEvent {
+    const char* mCategory {};
+    const char* mName {};
+    uint64_t    mStart {};
+    uint64_t    mDuration {};
+    int         mThreadID {};
+};
+
+/**
+ * Collects trace spans into per-thread ring buffers and dumps them in Chrome trace (Perfetto) JSON format.
+ */
+class Tracer {
+public:
+    static constexpr size_t cDefaultBufferSize = 4096;
+
+    /**
+     * Returns tracer instance.
+     *
+     * @return Tracer&.
+     */
+    static Tracer& Get();
+
+    /**
+     * Returns whether tracing is enabled. Spans are not recorded when tracing is disabled.
+     *
+     * @return bool.
+     */
+    static bool IsEnabled() { return sEnabled.load(std::memory_order_relaxed); }
+
+    /**
+     * Returns monotonic timestamp in microseconds.
+     *
+     * @return uint64_t.
+     */
+    static uint64_t Now();
+
+    /**
+     * Enables tracing. If dump file is set, the trace is dumped to it on SIGUSR1.
+     *
+     * @param dumpFile trace dump file.
+     * @param bufferSize max number of events kept per thread.
+     * @return Error.
+     */
+    Error Enable(const std::string& dumpFile = "", size_t bufferSize = cDefaultBufferSize);
+
+    /**
+     * Disables tracing.
+     */
+    void Disable();
+
+    /**
+     * Adds trace event. Category and name should be string literals as they are stored by pointer.
+     *
+     * @param category event category.
+     * @param name event name.
+     * @param start event start timestamp.
+     * @param duration event duration.
+     */
+    void AddEvent(const char* category, const char* name, uint64_t start, uint64_t duration);
+
+    /**
+     * Returns recorded events sorted by start time.
+     *
+     * @return std::vector<TraceEvent>.
+     */
+    std::vector<TraceEvent> GetEvents() const;
+
+    /**
+     * Returns recorded events in Chrome trace JSON format.
+     *
+     * @return std::string.
+     */
+    std::string GetTraceJSON() const;
+
+    /**
+     * Dumps recorded events to file.
+     *
+     * @param path dump file path, configured dump file is used if empty.
+     * @return Error.
+     */
+    Error Dump(const std::string& path = "") const;
+
+    /**
+     * Clears recorded events.
+     */
+    void Clear();
+
+private:
+    struct ThreadBuffer {
+        std::mutex              mMutex;
+        std::vector<TraceEvent> mEvents;
+        size_t                  mNext {};
+        size_t                  mCount {};
+        bool                    mInUse {};
+    };
+
+    class ThreadBufferHolder {
+    public:
+        ~ThreadBufferHolder();
+
+        std::shared_ptr<ThreadBuffer> mBuffer;
+    };
+
+    static void SignalHandler(int sig);
+
+    std::shared_ptr<ThreadBuffer> AcquireThreadBuffer();
+    Poco::JSON::Object::Ptr       CreateTraceJSON() const;
+    Error                         StartDumpThread();
+    void                          StopDumpThread();
+    void                          DumpOnSignal();
+
+    static std::atomic_bool sEnabled;
+    static int              sSignalPipe[2];
+
+    mutable std::mutex                         mMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> mBuffers;
+    size_t                                     mBufferSize = cDefaultBufferSize;
+    std::string                                mDumpFile;
+    std::thread                                mDumpThread;
+};
+
+/**
+ * Scoped trace span: records an event from construction to destruction if tracing is enabled.
+ */
+class TraceSpan {
+public:
+    /**
+     * Constructor.
+     *
+     * @param category span category.
+     * @param name span name.
+     */
+    TraceSpan(const char* category, const char* name)
+        : mCategory(category)
+        , mName(name)
+        , mStart(Tracer::IsEnabled() ? Tracer::Now() : 0)
+    {
+    }
+
+    /**
+     * Destructor.
+     */
+    ~TraceSpan()
+    {
+        if (mStart != 0 && Tracer::IsEnabled()) {
+            Tracer::Get().AddEvent(mCategory, mName, mStart, Tracer::Now() - mStart);
+        }
+    }
+
+    TraceSpan(const TraceSpan&)            = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* mCategory;
+    const char* mName;
+    uint64_t    mStart;
+};
+
+} // namespace aos::common::utils
+
+#define AOS_TRACE_CONCAT_IMPL(a, b) a##b
+#define AOS_TRACE_CONCAT(a, b)      AOS_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * Traces current scope.
+ */
+#define AOS_TRACE_SPAN(category, name)                                                                                 \
+    ::aos::common::utils::TraceSpan AOS_TRACE_CONCAT(aosTraceSpan, __LINE__)(category, name)
+
+/**
+ * Traces current function.
+ */
+#define AOS_TRACE_FUNCTION(category) AOS_TRACE_SPAN(category, __func__)
+
+#endif
@@ -9,6 +9,7 @@
 #include <core/iam/certhandler/certmodule.hpp>
 
 #include <common/utils/exception.hpp>
+#include <common/utils/startuporchestrator.hpp>
 #include <common/version/version.hpp>
 #include <iam/config/config.hpp>
 #include <iam/identhandler/identhandler.hpp>
@@ -111,91 +112,138 @@ void AosCore::Init(const std::string& configFile, bool provisioning)
     auto config = config::ParseConfig(configFile.empty() ? cDefaultConfigFile : configFile);
     AOS_ERROR_CHECK_AND_THROW(config.mError, "can't parse config");
 
-    err = mDatabase.Init(config.mValue.mDatabase);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize database");
+    // Modules are initialized concurrently, each step depends on the modules it uses during initialization.
+
+    common::utils::StartupOrchestrator orchestrator("IAM init");
+
+    auto addStep = [&orchestrator](const std::string& name, common::utils::StartupOrchestrator::Step step,
+                       const std::vector<std::string>& dependencies = {}) {
+        auto err = orchestrator.AddStep(name, std::move(step), dependencies);
+        AOS_ERROR_CHECK_AND_THROW(err, "can't add init step");
+    };
+
+    addStep("database", [this, &config]() { return mDatabase.Init(config.mValue.mDatabase); });
+    addStep("current node handler", [this, &config]() { return mCurrentNodeHandler.Init(config.mValue.mNodeInfo); });
+
+    // Crypto provider, PKCS11 manager, cert loader and cert modules (PKCS11 modules) are chained as crypto and PKCS11
+    // library initialization is not reentrant. The allocator is thread safe and needs no ordering.
+    addStep("crypto provider", [this]() { return mCryptoProvider.Init(mAllocator); });
+    addStep(
+        "identifier module", [this, &config]() { return InitIdentifierModule(config.mValue.mIdentifier); },
+        {"crypto provider"});
+    addStep(
+        "PKCS11 manager", [this]() { return mPKCS11Manager.Init(mAllocator); }, {"crypto provider"});
+    addStep(
+        "cert loader", [this]() { return mCertLoader.Init(mAllocator, mCryptoProvider, mPKCS11Manager); },
+        {"crypto provider", "PKCS11 manager"});
+    addStep(
+        "TLS credentials",
+        [this, &config]() {
+            return mTLSCredentials.Init(config.mValue.mIAMClient.mCACert, mCertHandler, mCertLoader, mCryptoProvider);
+        },
+        {"cert loader"});
+    addStep(
+        "cert modules", [this, &config]() { return InitCertModules(config.mValue); }, {"database", "cert loader"});
+
+    std::vector<std::string> serverDependencies {
+        "identifier module", "cert loader", "current node handler", "node manager", "provision manager"};
 
-    err = mCurrentNodeHandler.Init(config.mValue.mNodeInfo);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize current node handler");
+    if (config.mValue.mEnablePermissionsHandler) {
+        addStep(
+            "permissions handler",
+            [this]() {
+                mPermHandler = std::make_unique<permhandler::PermHandler>();
 
-    err = InitIdentifierModule(config.mValue.mIdentifier);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize identifier module");
+                return mPermHandler->Init(mCryptoProvider);
+            },
+            {"crypto provider"});
 
-    err = mCryptoProvider.Init(mAllocator);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize crypto provider");
+        serverDependencies.push_back("permissions handler");
+    }
 
-    err = mPKCS11Manager.Init(mAllocator);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize PKCS11 manager");
+    addStep(
+        "node manager", [this]() { return mNodeManager.Init(mAllocator, mDatabase); }, {"database"});
+    addStep(
+        "provision manager", [this]() { return mProvisionManager.Init(mIAMServer, mCertHandler); }, {"cert modules"});
+    addStep(
+        "IAM server",
+        [this, &config]() {
+            return mIAMServer.Init(config.mValue.mIAMServer, mCertHandler, *mIdentifier, *mPermHandler, mCertLoader,
+                mCryptoProvider, mCurrentNodeHandler, mNodeManager, mCertHandler, mProvisionManager, mProvisioning);
+        },
+        serverDependencies);
 
-    err = mCertLoader.Init(mAllocator, mCryptoProvider, mPKCS11Manager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize cert loader");
+    const auto& clientConfig = config.mValue.mIAMClient;
+    if (!clientConfig.mMainIAMPublicServerURL.empty() && !clientConfig.mMainIAMProtectedServerURL.empty()) {
+        addStep(
+            "IAM client",
+            [this, &clientConfig]() {
+                mIAMClient = std::make_unique<iamclient::IAMClient>();
+
+                return mIAMClient->Init(clientConfig, mIdentifier.get(), mCertHandler, mProvisionManager,
+                    mTLSCredentials, mCurrentNodeHandler, mProvisioning);
+            },
+            {"identifier module", "provision manager", "TLS credentials", "current node handler"});
+    }
 
-    err = mTLSCredentials.Init(config.mValue.mIAMClient.mCACert, mCertHandler, mCertLoader, mCryptoProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize TLS credentials");
+    err = orchestrator.Run();
 
-    err = InitCertModules(config.mValue);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize cert modules");
+    orchestrator.LogTimings();
 
-    if (config.mValue.mEnablePermissionsHandler) {
-        mPermHandler = std::make_unique<permhandler::PermHandler>();
+    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize IAM");
+}
 
-        err = mPermHandler->Init(mCryptoProvider);
-        AOS_ERROR_CHECK_AND_THROW(err, "can't initialize permissions handler");
-    }
+void AosCore::Start()
+{
+    LOG_INF() << "Start IAM" << Log::Field("provisioning", mProvisioning);
 
-    err = mNodeManager.Init(mAllocator, mDatabase);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize node manager");
+    common::utils::StartupOrchestrator orchestrator("IAM start");
 
-    err = mProvisionManager.Init(mIAMServer, mCertHandler);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize provision manager");
+    auto addStep = [this, &orchestrator](const std::string& name, std::function<Error()> start,
+                       std::function<Error()> stop, const std::vector<std::string>& dependencies = {}) {
+        auto step = [this, name, start = std::move(start), stop = std::move(stop)]() {
+            if (auto err = start(); !err.IsNone()) {
+                return err;
+            }
 
-    err = mIAMServer.Init(config.mValue.mIAMServer, mCertHandler, *mIdentifier, *mPermHandler, mCertLoader,
-        mCryptoProvider, mCurrentNodeHandler, mNodeManager, mCertHandler, mProvisionManager, mProvisioning);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize IAM server");
+            mCleanupManager.AddCleanup([name, stop]() {
+                if (auto err = stop(); !err.IsNone()) {
+                    LOG_ERR() << "Can't stop module" << Log::Field("name", name.c_str()) << Log::Field(err);
+                }
+            });
 
-    const auto& clientConfig = config.mValue.mIAMClient;
-    if (!clientConfig.mMainIAMPublicServerURL.empty() && !clientConfig.mMainIAMProtectedServerURL.empty()) {
-        mIAMClient = std::make_unique<iamclient::IAMClient>();
+            return Error(ErrorEnum::eNone);
+        };
 
-        err = mIAMClient->Init(clientConfig, mIdentifier.get(), mCertHandler, mProvisionManager, mTLSCredentials,
-            mCurrentNodeHandler, mProvisioning);
-        AOS_ERROR_CHECK_AND_THROW(err, "can't initialize IAM client");
-    }
-}
+        auto err = orchestrator.AddStep(name, std::move(step), dependencies);
+        AOS_ERROR_CHECK_AND_THROW(err, "can't add start step");
+    };
 
-void AosCore::Start()
-{
-    LOG_INF() << "Start IAM" << Log::Field("provisioning", mProvisioning);
+    // Identifier notifies IAM server, so IAM server is started after it, and IAM client is started last.
+    std::vector<std::string> serverDependencies;
 
     if (mIdentifier) {
-        auto err = mIdentifier->Start();
-        AOS_ERROR_CHECK_AND_THROW(err, "can't start identifier module");
+        addStep(
+            "identifier module", [this]() { return mIdentifier->Start(); }, [this]() { return mIdentifier->Stop(); });
 
-        mCleanupManager.AddCleanup([this]() {
-            if (auto err = mIdentifier->Stop(); !err.IsNone()) {
-                LOG_ERR() << "Can't stop identifier module: err=" << err;
-            }
-        });
+        serverDependencies.push_back("identifier module");
     }
 
-    auto err = mIAMServer.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start IAM server");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mIAMServer.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop IAM server: err=" << err;
-        }
-    });
+    addStep(
+        "IAM server", [this]() { return mIAMServer.Start(); }, [this]() { return mIAMServer.Stop(); },
+        serverDependencies);
 
     if (mIAMClient) {
-        err = mIAMClient->Start();
-        AOS_ERROR_CHECK_AND_THROW(err, "can't start IAM client");
-
-        mCleanupManager.AddCleanup([this]() {
-            if (auto err = mIAMClient->Stop(); !err.IsNone()) {
-                LOG_ERR() << "Can't stop IAM client: err=" << err;
-            }
-        });
+        addStep(
+            "IAM client", [this]() { return mIAMClient->Start(); }, [this]() { return mIAMClient->Stop(); },
+            {"IAM server"});
     }
+
+    auto err = orchestrator.Run();
+
+    orchestrator.LogTimings();
+
+    AOS_ERROR_CHECK_AND_THROW(err, "can't start IAM");
 }
 
 void AosCore::Stop()
@@ -80,6 +80,7 @@ private:
     static constexpr auto cDefaultConfigFile = "aos_iamanager.cfg";
     static constexpr auto cPKCS11CertModule  = "pkcs11module";
 
+    // Shared by all modules, thread safe.
     aos::HeapAllocator mAllocator;
 
     crypto::DefaultCryptoProvider mCryptoProvider;
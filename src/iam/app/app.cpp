@@ -17,6 +17,7 @@
 #include <core/common/version/version.hpp>
 
 #include <common/utils/exception.hpp>
+#include <common/utils/tracer.hpp>
 #include <common/version/version.hpp>
 
 #include "app.hpp"
@@ -117,11 +118,17 @@ void App::uninitialize()
 {
     Application::uninitialize();
 
-    if (!mInitialized) {
-        return;
+    if (mInitialized) {
+        mAosCore->Stop();
     }
 
-    mAosCore->Stop();
+    if (common::utils::Tracer::IsEnabled()) {
+        if (auto err = common::utils::Tracer::Get().Dump(); !err.IsNone()) {
+            LOG_ERR() << "Can't dump trace" << Log::Field(err);
+        }
+
+        common::utils::Tracer::Get().Disable();
+    }
 }
 
 void App::reinitialize(Application& self)
@@ -160,6 +167,9 @@ void App::defineOptions(Poco::Util::OptionSet& options)
     options.addOption(Poco::Util::Option("config", "c", "path to config file")
                           .argument("${file}")
                           .callback(Poco::Util::OptionCallback<App>(this, &App::HandleConfigFile)));
+    options.addOption(Poco::Util::Option("trace", "t", "enables tracing, trace is dumped on SIGUSR1 and on exit")
+                          .argument("${file}")
+                          .callback(Poco::Util::OptionCallback<App>(this, &App::HandleTrace)));
 }
 
 /***********************************************************************************************************************
@@ -233,4 +243,13 @@ void App::HandleConfigFile(const std::string& name, const std::string& value)
     mConfigFile = value;
 }
 
+void App::HandleTrace(const std::string& name, const std::string& value)
+{
+    (void)name;
+
+    if (auto err = common::utils::Tracer::Get().Enable(value); !err.IsNone()) {
+        throw Poco::Exception("can't enable tracing", value);
+    }
+}
+
 } // namespace aos::iam::app
@@ -40,6 +40,7 @@ private:
     void HandleJournal(const std::string& name, const std::string& value);
     void HandleLogLevel(const std::string& name, const std::string& value);
     void HandleConfigFile(const std::string& name, const std::string& value);
+    void HandleTrace(const std::string& name, const std::string& value);
 
     std::unique_ptr<AosCore> mAosCore;
     common::logger::Logger   mLogger;
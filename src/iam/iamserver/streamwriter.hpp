@@ -72,6 +72,9 @@ public:
     {
         uint32_t lastNotificationID = 0;
 
+        // Confirm subscription right away: clients treat the stream as established once initial metadata is received.
+        writer->SendInitialMetadata();
+
         while (mIsRunning && !context->IsCancelled()) {
             std::shared_lock lock {mMutex};
 
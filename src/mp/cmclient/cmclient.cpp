@@ -4,6 +4,11 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <filesystem>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
 #include <common/logger/logmodule.hpp>
 #include <common/utils/grpchelper.hpp>
 
@@ -11,6 +16,53 @@
 
 namespace aos::mp::cmclient {
 
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+using OutgoingMessages = servicemanager::v4::SMOutgoingMessages;
+
+const auto cRegisterSMMethod = std::string("/") + SMService::service_full_name() + "/RegisterSM";
+
+// Only the leading field tag is decoded: SM sends exactly one oneof field per message, so its number is the message
+// case. The field length is checked to drop truncated messages before they are forwarded to CM.
+RetWithError<OutgoingMessages::SMOutgoingMessageCase> GetOutgoingMessageCase(const std::vector<uint8_t>& data)
+{
+    using WireFormatLite = google::protobuf::internal::WireFormatLite;
+
+    google::protobuf::io::CodedInputStream input(data.data(), static_cast<int>(data.size()));
+
+    auto tag = input.ReadTag();
+    if (tag == 0) {
+        return {OutgoingMessages::SMOUTGOINGMESSAGE_NOT_SET, ErrorEnum::eNone};
+    }
+
+    auto field = OutgoingMessages::descriptor()->FindFieldByNumber(WireFormatLite::GetTagFieldNumber(tag));
+    if (field == nullptr || field->containing_oneof() == nullptr
+        || WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+        return {OutgoingMessages::SMOUTGOINGMESSAGE_NOT_SET, Error(ErrorEnum::eInvalidArgument, "invalid message")};
+    }
+
+    uint32_t length = 0;
+
+    if (!input.ReadVarint32(&length) || length != static_cast<uint32_t>(input.BytesUntilLimit())) {
+        return {OutgoingMessages::SMOUTGOINGMESSAGE_NOT_SET, Error(ErrorEnum::eInvalidArgument, "invalid message")};
+    }
+
+    return {static_cast<OutgoingMessages::SMOutgoingMessageCase>(field->number()), ErrorEnum::eNone};
+}
+
+grpc::ByteBuffer ToByteBuffer(const std::vector<uint8_t>& data)
+{
+    grpc::Slice slice(data.data(), data.size());
+
+    return grpc::ByteBuffer(&slice, 1);
+}
+
+} // namespace
+
 /***********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
@@ -27,6 +79,13 @@ Error CMClient::Init(const config::Config& config, common::iamclient::TLSCredent
     mInsecureConnection = insecureConnection;
     mCertStorage        = config.mCertStorage;
 
+    auto spillDir = config.mWorkingDir.empty() ? std::string()
+                                               : (std::filesystem::path(config.mWorkingDir) / cCacheDir).string();
+
+    if (auto err = mMessageCache.Init(spillDir); !err.IsNone()) {
+        return err;
+    }
+
     auto [credentials, err] = CreateCredentials();
     if (!err.IsNone()) {
         return err;
@@ -169,30 +228,41 @@ RetWithError<std::shared_ptr<grpc::ChannelCredentials>> CMClient::CreateCredenti
     return mCertProvider->GetMTLSClientCredentials(mCertStorage.c_str());
 }
 
-SMServiceStubPtr CMClient::CreateSMStub(const std::string& url)
+std::shared_ptr<grpc::Channel> CMClient::CreateSMChannel(const std::string& url)
 {
     auto channel = grpc::CreateCustomChannel(url, mCredentials, common::utils::CreateGRPCChannelArguments());
     if (!channel) {
         throw std::runtime_error("failed to create channel");
     }
 
-    return SMService::NewStub(channel);
+    return channel;
 }
 
 void CMClient::RegisterSM(const std::string& url)
 {
+    {
+        // Outgoing messages are written under the cache lock, release the previous stream under it as well.
+        std::lock_guard lock {mCacheMutex};
+
+        mStream.reset();
+    }
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Registering SM service: url=" << url.c_str();
 
-    mSMStub = CreateSMStub(url);
+    mSMChannel = CreateSMChannel(url);
+    mCtx       = std::make_unique<grpc::ClientContext>();
 
-    mCtx = std::make_unique<grpc::ClientContext>();
+    // Generic byte buffer stream on the RegisterSM method: messages are forwarded as already serialized by SM.
+    auto stream = std::make_unique<GenericStream>();
 
-    if (mStream = mSMStub->RegisterSM(mCtx.get()); !mStream) {
+    if (auto err = stream->Start(mSMChannel, cRegisterSMMethod, *mCtx); !err.IsNone()) {
         throw std::runtime_error("failed to register service to SM");
     }
 
+    mStream = std::move(stream);
+
     mCMConnected = true;
     mCV.notify_one();
 }
@@ -228,17 +298,24 @@ void CMClient::ProcessIncomingSMMessage()
 {
     LOG_DBG() << "Processing SM message";
 
-    servicemanager::v4::SMIncomingMessages incomingMsg;
-
-    while (mStream->Read(&incomingMsg)) {
-        std::vector<uint8_t> data(incomingMsg.ByteSizeLong());
+    grpc::ByteBuffer         buffer;
+    std::vector<grpc::Slice> slices;
 
-        if (!incomingMsg.SerializeToArray(data.data(), static_cast<int>(data.size()))) {
-            LOG_ERR() << "Failed to serialize message";
+    while (mStream->Read(&buffer)) {
+        if (!buffer.Dump(&slices).ok()) {
+            LOG_ERR() << "Failed to read message";
 
             continue;
         }
 
+        std::vector<uint8_t> data;
+
+        data.reserve(buffer.Length());
+
+        for (const auto& slice : slices) {
+            data.insert(data.end(), slice.begin(), slice.end());
+        }
+
         LOG_DBG() << "Sending message to handler";
 
         if (auto err = mIncomingMsgChannel.Send(std::move(data)); !err.IsNone()) {
@@ -261,28 +338,30 @@ void CMClient::ProcessOutgoingSMMessages()
             return;
         }
 
-        {
-            std::unique_lock lock {mMutex};
-            mCV.wait(lock, [this] { return mCMConnected || mShutdown.load(); });
+        auto [messageCase, caseErr] = GetOutgoingMessageCase(msg);
+        if (!caseErr.IsNone()) {
+            LOG_ERR() << "Failed to parse outgoing message: error=" << caseErr;
 
-            if (mShutdown) {
-                return;
-            }
+            continue;
         }
 
-        servicemanager::v4::SMOutgoingMessages outgoingMsg;
-        if (!outgoingMsg.ParseFromArray(msg.data(), static_cast<int>(msg.size()))) {
-            LOG_ERR() << "Failed to parse outgoing message";
+        // Cache lock serializes stream writes with the cache flush. It is not taken together with mMutex, so Close
+        // and certificate change can always cancel a blocked write.
+        std::lock_guard lock {mCacheMutex};
+
+        // Don't block SM while CM is unreachable. Keep caching until the cache is flushed to preserve order.
+        if (!mCMConnected || !mMessageCache.IsEmpty()) {
+            CacheMessage(messageCase, std::move(msg));
 
             continue;
         }
 
         LOG_DBG() << "Sending message to CM";
 
-        if (!mStream->Write(outgoingMsg)) {
+        if (!mStream->Write(ToByteBuffer(msg))) {
             LOG_ERR() << "Failed to send message";
 
-            CacheMessage(outgoingMsg);
+            CacheMessage(messageCase, std::move(msg));
 
             continue;
         }
@@ -293,37 +372,34 @@ void CMClient::ProcessOutgoingSMMessages()
 
 void CMClient::SendCachedMessages()
 {
-    std::lock_guard lock {mMutex};
+    std::lock_guard lock {mCacheMutex};
 
-    while (!mMessageCache.empty()) {
-        const auto& message = mMessageCache.front();
+    while (!mMessageCache.IsEmpty()) {
+        auto [message, err] = mMessageCache.Front();
+        if (!err.IsNone()) {
+            LOG_ERR() << "Failed to get cached message: error=" << err;
 
-        if (!mStream->Write(message)) {
+            mMessageCache.Pop();
+
+            continue;
+        }
+
+        if (!mStream->Write(ToByteBuffer(message))) {
             throw std::runtime_error("failed to send cached message");
         }
 
-        mMessageCache.pop();
+        mMessageCache.Pop();
 
         LOG_DBG() << "Successfully sent cached message";
     }
 }
 
-void CMClient::CacheMessage(const servicemanager::v4::SMOutgoingMessages& message)
+void CMClient::CacheMessage(MessageCache::MessageCase messageCase, std::vector<uint8_t> message)
 {
-    std::lock_guard lock {mMutex};
-
-    switch (message.SMOutgoingMessage_case()) {
-    case servicemanager::v4::SMOutgoingMessages::kNodeConfigStatus:
-        LOG_DBG() << "Caching NodeConfigStatus message";
-
-        mMessageCache.push(message);
-
-        break;
-
-    default:
-        LOG_ERR() << "Skipping caching message";
+    LOG_DBG() << "Caching message: type=" << static_cast<int>(messageCase);
 
-        break;
+    if (auto err = mMessageCache.Push(messageCase, std::move(message)); !err.IsNone()) {
+        LOG_ERR() << "Failed to cache message: error=" << err;
     }
 }
 
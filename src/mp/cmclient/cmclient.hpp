@@ -10,13 +10,13 @@
 #include <atomic>
 #include <condition_variable>
 #include <memory>
-#include <queue>
 #include <thread>
 
 #include <Poco/Runnable.h>
 #include <Poco/ThreadPool.h>
 
 #include <grpcpp/security/credentials.h>
+#include <grpcpp/support/byte_buffer.h>
 
 #include <core/common/crypto/itf/certloader.hpp>
 #include <core/common/crypto/itf/crypto.hpp>
@@ -29,13 +29,18 @@
 #include <mp/communication/types.hpp>
 #include <mp/config/config.hpp>
 
-using SMService        = servicemanager::v4::SMService;
-using SMServiceStubPtr = std::unique_ptr<SMService::StubInterface>;
+#include "genericstream.hpp"
+#include "messagecache.hpp"
+
+using SMService = servicemanager::v4::SMService;
 
 namespace aos::mp::cmclient {
 
 /**
  * CMClient class.
+ *
+ * Messages are forwarded between the SM channel and CM as raw serialized bytes over a byte buffer stream. Outgoing
+ * messages are not parsed: only the leading field tag and length are decoded to validate and cache them.
  */
 class CMClient : public communication::HandlerItf, public iamclient::CertListenerItf {
 public:
@@ -88,9 +93,9 @@ public:
 
 private:
     constexpr static auto cReconnectTimeout = std::chrono::seconds(3);
+    constexpr static auto cCacheDir         = "cmcache";
 
-    using StreamPtr = std::unique_ptr<grpc::ClientReaderWriterInterface<::servicemanager::v4::SMOutgoingMessages,
-        servicemanager::v4::SMIncomingMessages>>;
+    using StreamPtr = std::unique_ptr<GenericStream>;
 
     template <typename F>
     class RunnableWrapper : public Poco::Runnable {
@@ -112,13 +117,13 @@ private:
     }
 
     void                                                    RunCM(const std::string& url);
-    SMServiceStubPtr                                        CreateSMStub(const std::string& url);
+    std::shared_ptr<grpc::Channel>                          CreateSMChannel(const std::string& url);
     void                                                    RegisterSM(const std::string& url);
     void                                                    ProcessIncomingSMMessage();
     void                                                    ProcessOutgoingSMMessages();
     RetWithError<std::shared_ptr<grpc::ChannelCredentials>> CreateCredentials();
     void                                                    Close();
-    void CacheMessage(const servicemanager::v4::SMOutgoingMessages& message);
+    void CacheMessage(MessageCache::MessageCase messageCase, std::vector<uint8_t> message);
     void SendCachedMessages();
 
     std::thread      mCMThread;
@@ -126,26 +131,29 @@ private:
     Poco::ThreadPool mThreadPool;
 
     std::atomic<bool> mShutdown {false};
-    bool              mCMConnected {false};
+    std::atomic<bool> mCMConnected {false};
     bool              mInsecureConnection {};
     std::string       mCertStorage;
 
     std::mutex              mMutex;
+    std::mutex              mCacheMutex;
     std::condition_variable mCV;
 
     std::shared_ptr<grpc::ChannelCredentials> mCredentials;
-    SMServiceStubPtr                          mSMStub;
-    StreamPtr                                 mStream;
-    std::unique_ptr<grpc::ClientContext>      mCtx;
+    std::shared_ptr<grpc::Channel>            mSMChannel;
     std::string                               mUrl;
 
-    common::iamclient::TLSCredentialsItf*              mCertProvider {};
-    crypto::CertLoaderItf*                             mCertLoader {};
-    crypto::x509::ProviderItf*                         mCryptoProvider {};
-    common::utils::Channel<std::vector<uint8_t>>       mOutgoingMsgChannel;
-    common::utils::Channel<std::vector<uint8_t>>       mIncomingMsgChannel;
-    bool                                               mNotifyConnected {};
-    std::queue<servicemanager::v4::SMOutgoingMessages> mMessageCache;
+    // Stream finishes the call on destruction, so it is declared after the context.
+    std::unique_ptr<grpc::ClientContext> mCtx;
+    StreamPtr                            mStream;
+
+    common::iamclient::TLSCredentialsItf*        mCertProvider {};
+    crypto::CertLoaderItf*                       mCertLoader {};
+    crypto::x509::ProviderItf*                   mCryptoProvider {};
+    common::utils::Channel<std::vector<uint8_t>> mOutgoingMsgChannel;
+    common::utils::Channel<std::vector<uint8_t>> mIncomingMsgChannel;
+    bool                                         mNotifyConnected {};
+    MessageCache                                 mMessageCache;
 };
 
 } // namespace aos::mp::cmclient
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "genericstream.hpp"
+
+namespace aos::mp::cmclient {
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+GenericStream::~GenericStream()
+{
+    if (mCall) {
+        // Cancel completes pending read and write, then the call can be finished.
+        mCtx->TryCancel();
+
+        grpc::Status status;
+
+        WaitOperation([this, &status](void* tag) { mCall->Finish(&status, tag); });
+    }
+
+    mCompletionQueue.Shutdown();
+
+    if (mPollThread.joinable()) {
+        mPollThread.join();
+    }
+}
+
+Error GenericStream::Start(
+    const std::shared_ptr<grpc::Channel>& channel, const std::string& method, grpc::ClientContext& ctx)
+{
+    mStub = std::make_unique<grpc::GenericStub>(channel);
+
+    auto call = mStub->PrepareCall(&ctx, method, &mCompletionQueue);
+    if (!call) {
+        return Error(ErrorEnum::eFailed, "can't prepare call");
+    }
+
+    mCtx        = &ctx;
+    mCall       = std::move(call);
+    mPollThread = std::thread(&GenericStream::PollCompletionQueue, this);
+
+    if (!WaitOperation([this](void* tag) { mCall->StartCall(tag); })) {
+        return Error(ErrorEnum::eFailed, "can't start call");
+    }
+
+    return ErrorEnum::eNone;
+}
+
+bool GenericStream::Read(grpc::ByteBuffer* buffer)
+{
+    return WaitOperation([this, buffer](void* tag) { mCall->Read(buffer, tag); });
+}
+
+bool GenericStream::Write(const grpc::ByteBuffer& buffer)
+{
+    return WaitOperation([this, &buffer](void* tag) { mCall->Write(buffer, tag); });
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+void GenericStream::PollCompletionQueue()
+{
+    void* tag = nullptr;
+    bool  ok  = false;
+
+    while (mCompletionQueue.Next(&tag, &ok)) {
+        static_cast<std::promise<bool>*>(tag)->set_value(ok);
+    }
+}
+
+} // namespace aos::mp::cmclient
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_MP_CMCLIENT_GENERICSTREAM_HPP_
+#define AOS_MP_CMCLIENT_GENERICSTREAM_HPP_
+
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include <core/common/tools/error.hpp>
+
+namespace aos::mp::cmclient {
+
+/**
+ * Blocking bidirectional stream of serialized messages on a generic gRPC call.
+ *
+ * One read and one write may be in progress at the same time. Operations are completed by a completion queue thread.
+ * The stream cancels and finishes the call on destruction, so the client context should outlive the stream.
+ */
+class GenericStream {
+public:
+    /**
+     * Destructor.
+     */
+    ~GenericStream();
+
+    /**
+     * Starts call.
+     *
+     * @param channel channel.
+     * @param method full method name.
+     * @param ctx client context.
+     * @return Error.
+     */
+    Error Start(const std::shared_ptr<grpc::Channel>& channel, const std::string& method, grpc::ClientContext& ctx);
+
+    /**
+     * Reads message.
+     *
+     * @param buffer[out] message buffer.
+     * @return true if message is read, false if the stream is closed.
+     */
+    bool Read(grpc::ByteBuffer* buffer);
+
+    /**
+     * Writes message.
+     *
+     * @param buffer message buffer.
+     * @return true if message is written, false if the stream is closed.
+     */
+    bool Write(const grpc::ByteBuffer& buffer);
+
+private:
+    template <typename F>
+    static bool WaitOperation(F&& operation)
+    {
+        std::promise<bool> done;
+        auto               result = done.get_future();
+
+        operation(&done);
+
+        return result.get();
+    }
+
+    void PollCompletionQueue();
+
+    std::unique_ptr<grpc::GenericStub>                    mStub;
+    grpc::CompletionQueue                                 mCompletionQueue;
+    std::unique_ptr<grpc::GenericClientAsyncReaderWriter> mCall;
+    grpc::ClientContext*                                  mCtx {};
+    std::thread                                           mPollThread;
+};
+
+} // namespace aos::mp::cmclient
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include <common/logger/logmodule.hpp>
+#include <common/utils/exception.hpp>
+
+#include "messagecache.hpp"
+
+namespace aos::mp::cmclient {
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+Error MessageCache::Init(const std::string& spillDir, size_t maxSize, size_t maxMemorySize)
+{
+    LOG_DBG() << "Init message cache: spillDir=" << spillDir.c_str() << ", maxSize=" << maxSize
+              << ", maxMemorySize=" << maxMemorySize;
+
+    mSpillDir      = spillDir;
+    mMaxSize       = maxSize;
+    mMaxMemorySize = maxMemorySize;
+
+    Clear();
+
+    if (mSpillDir.empty()) {
+        return ErrorEnum::eNone;
+    }
+
+    // Spilled messages are only valid for the current process, remove leftovers of the previous run.
+    try {
+        std::filesystem::remove_all(mSpillDir);
+    } catch (const std::exception& e) {
+        return AOS_ERROR_WRAP(common::utils::ToAosError(e));
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error MessageCache::Push(MessageCase messageCase, std::vector<uint8_t> message)
+{
+    auto& lane = mLanes[GetLaneIndex(messageCase)];
+
+    if (lane.mCoalesce) {
+        auto it = std::find_if(lane.mEntries.begin(), lane.mEntries.end(),
+            [messageCase](const Entry& entry) { return entry.mCase == messageCase; });
+
+        if (it != lane.mEntries.end()) {
+            Remove(*it);
+            lane.mEntries.erase(it);
+        }
+    } else if (messageCase == servicemanager::v4::SMOutgoingMessages::kRunInstancesStatus) {
+        // Run instances status contains state of all instances and supersedes preceding instances statuses.
+        for (auto& entry : lane.mEntries) {
+            Remove(entry);
+        }
+
+        lane.mEntries.clear();
+    }
+
+    Entry entry {messageCase, message.size(), std::move(message), {}};
+
+    if (!lane.mCoalesce && !mSpillDir.empty() && mMemorySize + entry.mSize > mMaxMemorySize) {
+        if (auto err = Spill(entry); !err.IsNone()) {
+            LOG_WRN() << "Can't spill message, keep in memory: err=" << err;
+        }
+    }
+
+    if (entry.mSpillPath.empty()) {
+        mMemorySize += entry.mSize;
+    }
+
+    mSize += entry.mSize;
+
+    lane.mEntries.push_back(std::move(entry));
+
+    Evict();
+
+    return ErrorEnum::eNone;
+}
+
+RetWithError<std::vector<uint8_t>> MessageCache::Front() const
+{
+    for (const auto& lane : mLanes) {
+        if (lane.mEntries.empty()) {
+            continue;
+        }
+
+        const auto& entry = lane.mEntries.front();
+
+        if (entry.mSpillPath.empty()) {
+            return entry.mData;
+        }
+
+        std::vector<uint8_t> data(entry.mSize);
+        std::ifstream        file(entry.mSpillPath, std::ios::binary);
+
+        if (!file.read(reinterpret_cast<char*>(data.data()), data.size())) {
+            return {{}, Error(ErrorEnum::eRuntime, "failed to read spilled message")};
+        }
+
+        return data;
+    }
+
+    return {{}, ErrorEnum::eNotFound};
+}
+
+void MessageCache::Pop()
+{
+    for (auto& lane : mLanes) {
+        if (lane.mEntries.empty()) {
+            continue;
+        }
+
+        Remove(lane.mEntries.front());
+        lane.mEntries.pop_front();
+
+        return;
+    }
+}
+
+void MessageCache::Clear()
+{
+    for (auto& lane : mLanes) {
+        for (auto& entry : lane.mEntries) {
+            Remove(entry);
+        }
+
+        lane.mEntries.clear();
+    }
+}
+
+bool MessageCache::IsEmpty() const
+{
+    return std::all_of(mLanes.begin(), mLanes.end(), [](const Lane& lane) { return lane.mEntries.empty(); });
+}
+
+size_t MessageCache::Count() const
+{
+    size_t count = 0;
+
+    for (const auto& lane : mLanes) {
+        count += lane.mEntries.size();
+    }
+
+    return count;
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+size_t MessageCache::GetLaneIndex(MessageCase messageCase)
+{
+    switch (messageCase) {
+    case servicemanager::v4::SMOutgoingMessages::kNodeConfigStatus:
+    case servicemanager::v4::SMOutgoingMessages::kOverrideEnvVarStatus:
+        return 0;
+
+    case servicemanager::v4::SMOutgoingMessages::kRunInstancesStatus:
+    case servicemanager::v4::SMOutgoingMessages::kUpdateInstancesStatus:
+        return 1;
+
+    case servicemanager::v4::SMOutgoingMessages::kAlert:
+        return 2;
+
+    case servicemanager::v4::SMOutgoingMessages::kInstantMonitoring:
+        return 4;
+
+    case servicemanager::v4::SMOutgoingMessages::kLog:
+        return 5;
+
+    default:
+        return 3;
+    }
+}
+
+Error MessageCache::Spill(Entry& entry)
+{
+    try {
+        std::filesystem::create_directories(mSpillDir);
+
+        auto path = (std::filesystem::path(mSpillDir) / (std::to_string(mSpillCounter++) + ".msg")).string();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file.write(reinterpret_cast<const char*>(entry.mData.data()), entry.mData.size())) {
+            std::filesystem::remove(path);
+
+            return Error(ErrorEnum::eRuntime, "failed to spill message");
+        }
+
+        entry.mSpillPath = std::move(path);
+        entry.mData      = {};
+    } catch (const std::exception& e) {
+        return AOS_ERROR_WRAP(common::utils::ToAosError(e));
+    }
+
+    return ErrorEnum::eNone;
+}
+
+void MessageCache::Remove(Entry& entry)
+{
+    mSize -= entry.mSize;
+
+    if (entry.mSpillPath.empty()) {
+        mMemorySize -= entry.mSize;
+
+        return;
+    }
+
+    std::error_code ec;
+
+    std::filesystem::remove(entry.mSpillPath, ec);
+}
+
+void MessageCache::Evict()
+{
+    while (mSize > mMaxSize) {
+        auto lane = std::find_if(mLanes.rbegin(), mLanes.rend(),
+            [](const Lane& lane) { return !lane.mCoalesce && !lane.mEntries.empty(); });
+
+        if (lane == mLanes.rend()) {
+            return;
+        }
+
+        LOG_WRN() << "Message cache is full, drop message: type=" << static_cast<int>(lane->mEntries.front().mCase)
+                  << ", size=" << lane->mEntries.front().mSize;
+
+        Remove(lane->mEntries.front());
+        lane->mEntries.pop_front();
+    }
+}
+
+} // namespace aos::mp::cmclient
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_MP_CMCLIENT_MESSAGECACHE_HPP_
+#define AOS_MP_CMCLIENT_MESSAGECACHE_HPP_
+
+#include <array>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <core/common/tools/error.hpp>
+
+#include <servicemanager/v4/servicemanager.pb.h>
+
+namespace aos::mp::cmclient {
+
+/**
+ * Bounded cache of outgoing SM messages kept while CM is unreachable.
+ *
+ * Messages are grouped into lanes which are replayed in priority order. State messages (node config status, env vars
+ * status, instant monitoring) are coalesced: only the latest message of each type is kept. Run and update instances
+ * statuses share one FIFO lane to be replayed in the order they were sent, a run instances status drops all preceding
+ * instances statuses. Other messages are kept in FIFO order. When the total size exceeds the cap, the oldest messages
+ * of the lowest priority lane are dropped. FIFO messages above the memory cap are spilled to files in the spill
+ * directory.
+ *
+ * The cache is not thread safe.
+ */
+class MessageCache {
+public:
+    using MessageCase = servicemanager::v4::SMOutgoingMessages::SMOutgoingMessageCase;
+
+    static constexpr size_t cDefaultMaxSize       = 16 * 1024 * 1024; // 16 MB
+    static constexpr size_t cDefaultMaxMemorySize = 1024 * 1024;      // 1 MB
+
+    /**
+     * Initializes message cache.
+     *
+     * @param spillDir directory for spilled messages, spilling is disabled if empty.
+     * @param maxSize max total size of cached messages.
+     * @param maxMemorySize max size of cached messages kept in memory.
+     * @return Error.
+     */
+    Error Init(const std::string& spillDir, size_t maxSize = cDefaultMaxSize,
+        size_t maxMemorySize = cDefaultMaxMemorySize);
+
+    /**
+     * Adds message to the cache.
+     *
+     * @param messageCase message type.
+     * @param message serialized message.
+     * @return Error.
+     */
+    Error Push(MessageCase messageCase, std::vector<uint8_t> message);
+
+    /**
+     * Returns highest priority cached message.
+     *
+     * @return RetWithError<std::vector<uint8_t>>.
+     */
+    RetWithError<std::vector<uint8_t>> Front() const;
+
+    /**
+     * Removes highest priority cached message.
+     */
+    void Pop();
+
+    /**
+     * Removes all cached messages.
+     */
+    void Clear();
+
+    /**
+     * Checks if cache is empty.
+     *
+     * @return bool.
+     */
+    bool IsEmpty() const;
+
+    /**
+     * Returns number of cached messages.
+     *
+     * @return size_t.
+     */
+    size_t Count() const;
+
+    /**
+     * Returns total size of cached messages.
+     *
+     * @return size_t.
+     */
+    size_t Size() const { return mSize; }
+
+private:
+    static constexpr size_t cNumLanes = 6;
+
+    struct Entry {
+        MessageCase          mCase;
+        size_t               mSize;
+        std::vector<uint8_t> mData;
+        std::string          mSpillPath;
+    };
+
+    struct Lane {
+        bool              mCoalesce;
+        std::deque<Entry> mEntries;
+    };
+
+    static size_t GetLaneIndex(MessageCase messageCase);
+
+    Error Spill(Entry& entry);
+    void  Remove(Entry& entry);
+    void  Evict();
+
+    std::string                 mSpillDir;
+    size_t                      mMaxSize {cDefaultMaxSize};
+    size_t                      mMaxMemorySize {cDefaultMaxMemorySize};
+    size_t                      mSize {};
+    size_t                      mMemorySize {};
+    uint64_t                    mSpillCounter {};
+    std::array<Lane, cNumLanes> mLanes {{{true, {}}, {false, {}}, {false, {}}, {false, {}}, {true, {}}, {false, {}}}};
+};
+
+} // namespace aos::mp::cmclient
+
+#endif
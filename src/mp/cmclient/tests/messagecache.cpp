@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <mp/cmclient/messagecache.hpp>
+
+using namespace testing;
+
+namespace aos::mp::cmclient {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+const auto cSpillDir = std::filesystem::temp_directory_path() / "aos_messagecache_test";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+std::vector<uint8_t> CreateMessage(uint8_t id, size_t size = 8)
+{
+    return std::vector<uint8_t>(size, id);
+}
+
+size_t CountSpilledFiles()
+{
+    if (!std::filesystem::exists(cSpillDir)) {
+        return 0;
+    }
+
+    return std::distance(std::filesystem::directory_iterator(cSpillDir), std::filesystem::directory_iterator());
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class MessageCacheTest : public Test {
+protected:
+    void SetUp() override { tests::utils::InitLog(); }
+
+    void TearDown() override { std::filesystem::remove_all(cSpillDir); }
+
+    MessageCache mCache;
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(MessageCacheTest, CoalesceStateMessages)
+{
+    ASSERT_TRUE(mCache.Init("").IsNone());
+
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kNodeConfigStatus, CreateMessage(1)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kRunInstancesStatus, CreateMessage(2)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kNodeConfigStatus, CreateMessage(3)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kInstantMonitoring, CreateMessage(4)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kInstantMonitoring, CreateMessage(5)).IsNone());
+
+    EXPECT_EQ(mCache.Count(), 3);
+    EXPECT_EQ(mCache.Size(), 24);
+
+    for (auto id : {3, 2, 5}) {
+        auto [message, err] = mCache.Front();
+        ASSERT_TRUE(err.IsNone());
+        EXPECT_EQ(message, CreateMessage(id));
+
+        mCache.Pop();
+    }
+
+    EXPECT_TRUE(mCache.IsEmpty());
+    EXPECT_EQ(mCache.Size(), 0);
+    EXPECT_EQ(mCache.Front().mError, ErrorEnum::eNotFound);
+}
+
+TEST_F(MessageCacheTest, ReplayInPriorityOrder)
+{
+    ASSERT_TRUE(mCache.Init("").IsNone());
+
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kLog, CreateMessage(1)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kAlert, CreateMessage(2)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kClockSyncRequest, CreateMessage(3)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kUpdateInstancesStatus, CreateMessage(4)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kAlert, CreateMessage(5)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kNodeConfigStatus, CreateMessage(6)).IsNone());
+
+    for (auto id : {6, 4, 2, 5, 3, 1}) {
+        auto [message, err] = mCache.Front();
+        ASSERT_TRUE(err.IsNone());
+        EXPECT_EQ(message, CreateMessage(id));
+
+        mCache.Pop();
+    }
+
+    EXPECT_TRUE(mCache.IsEmpty());
+}
+
+TEST_F(MessageCacheTest, KeepInstancesStatusOrder)
+{
+    ASSERT_TRUE(mCache.Init("").IsNone());
+
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kUpdateInstancesStatus, CreateMessage(1)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kRunInstancesStatus, CreateMessage(2)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kUpdateInstancesStatus, CreateMessage(3)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kUpdateInstancesStatus, CreateMessage(4)).IsNone());
+
+    EXPECT_EQ(mCache.Count(), 3);
+    EXPECT_EQ(mCache.Size(), 24);
+
+    for (auto id : {2, 3, 4}) {
+        auto [message, err] = mCache.Front();
+        ASSERT_TRUE(err.IsNone());
+        EXPECT_EQ(message, CreateMessage(id));
+
+        mCache.Pop();
+    }
+
+    EXPECT_TRUE(mCache.IsEmpty());
+}
+
+TEST_F(MessageCacheTest, EvictLowPriorityMessages)
+{
+    ASSERT_TRUE(mCache.Init("", 32).IsNone());
+
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kNodeConfigStatus, CreateMessage(1)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kAlert, CreateMessage(2)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kLog, CreateMessage(3)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kLog, CreateMessage(4)).IsNone());
+    ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kAlert, CreateMessage(5)).IsNone());
+
+    EXPECT_EQ(mCache.Size(), 32);
+
+    for (auto id : {1, 2, 5, 4}) {
+        auto [message, err] = mCache.Front();
+        ASSERT_TRUE(err.IsNone());
+        EXPECT_EQ(message, CreateMessage(id));
+
+        mCache.Pop();
+    }
+
+    EXPECT_TRUE(mCache.IsEmpty());
+}
+
+TEST_F(MessageCacheTest, SpillToDisk)
+{
+    ASSERT_TRUE(mCache.Init(cSpillDir.string(), MessageCache::cDefaultMaxSize, 16).IsNone());
+
+    for (uint8_t id = 1; id <= 4; id++) {
+        ASSERT_TRUE(mCache.Push(servicemanager::v4::SMOutgoingMessages::kLog, CreateMessage(id)).IsNone());
+    }
+
+    EXPECT_EQ(CountSpilledFiles(), 2);
+
+    for (uint8_t id = 1; id <= 4; id++) {
+        auto [message, err] = mCache.Front();
+        ASSERT_TRUE(err.IsNone());
+        EXPECT_EQ(message, CreateMessage(id));
+
+        mCache.Pop();
+    }
+
+    EXPECT_EQ(CountSpilledFiles(), 0);
+    EXPECT_TRUE(mCache.IsEmpty());
+}
+
+} // namespace aos::mp::cmclient
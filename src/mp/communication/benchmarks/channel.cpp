@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include <mp/communication/communicationmanager.hpp>
+#include <mp/communication/utils.hpp>
+
+namespace aos::mp::communication {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto   cPort         = 30001;
+constexpr size_t cFramesWindow = 16;
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+// Serves the same frame over and over, as many times as granted by the reader. Written data is dropped.
+class FrameTransport : public TransportItf {
+public:
+    explicit FrameTransport(std::vector<uint8_t> frame)
+        : mFrame(std::move(frame))
+    {
+    }
+
+    void Grant(size_t numFrames)
+    {
+        std::lock_guard lock {mMutex};
+
+        mGranted += numFrames;
+        mCondVar.notify_one();
+    }
+
+    Error Connect() override { return ErrorEnum::eNone; }
+
+    Error Read(std::vector<uint8_t>& message) override
+    {
+        std::unique_lock lock {mMutex};
+
+        size_t copied = 0;
+
+        while (copied < message.size()) {
+            if (mOffset == 0) {
+                mCondVar.wait(lock, [this]() { return mGranted != 0 || mShutdown; });
+
+                if (mShutdown) {
+                    return ErrorEnum::eRuntime;
+                }
+
+                mGranted--;
+            }
+
+            auto size = std::min(mFrame.size() - mOffset, message.size() - copied);
+
+            std::memcpy(message.data() + copied, mFrame.data() + mOffset, size);
+
+            copied += size;
+            mOffset = (mOffset + size) % mFrame.size();
+        }
+
+        return ErrorEnum::eNone;
+    }
+
+    Error Write(std::vector<uint8_t> message) override
+    {
+        benchmark::DoNotOptimize(message.data());
+
+        return ErrorEnum::eNone;
+    }
+
+    Error Close() override { return ErrorEnum::eNone; }
+
+    Error Shutdown() override
+    {
+        std::lock_guard lock {mMutex};
+
+        mShutdown = true;
+        mCondVar.notify_one();
+
+        return ErrorEnum::eNone;
+    }
+
+private:
+    std::vector<uint8_t>    mFrame;
+    std::mutex              mMutex;
+    std::condition_variable mCondVar;
+    size_t                  mOffset {};
+    size_t                  mGranted {};
+    bool                    mShutdown {};
+};
+
+std::vector<uint8_t> CreateFrame(const std::vector<uint8_t>& data)
+{
+    auto frame = PrepareHeader(cPort, data);
+
+    frame.insert(frame.end(), data.begin(), data.end());
+
+    return frame;
+}
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+// Frames are read from the transport, checksum verified and dispatched to the channel by the manager thread.
+void BM_ChannelRead(benchmark::State& state)
+{
+    const std::vector<uint8_t> data(state.range(0), 0xAA);
+
+    config::Config       config;
+    FrameTransport       transport(CreateFrame(data));
+    CommunicationManager manager;
+
+    manager.Init(config, transport);
+
+    auto channel = manager.CreateChannel(cPort, nullptr, "");
+
+    manager.Start();
+    transport.Grant(cFramesWindow);
+
+    std::vector<uint8_t> message(data.size());
+
+    for (auto _ : state) {
+        if (auto err = channel->Read(message); !err.IsNone()) {
+            state.SkipWithError("channel read failed");
+
+            break;
+        }
+
+        transport.Grant(1);
+    }
+
+    manager.Stop();
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+BENCHMARK(BM_ChannelRead)->Arg(64)->Arg(4 * 1024)->Arg(64 * 1024)->UseRealTime();
+
+// Each message is framed with checksum and written to the transport in one write.
+void BM_ChannelWrite(benchmark::State& state)
+{
+    const std::vector<uint8_t> data(state.range(0), 0xAA);
+
+    config::Config       config;
+    FrameTransport       transport({});
+    CommunicationManager manager;
+
+    manager.Init(config, transport);
+
+    auto channel = manager.CreateChannel(cPort, nullptr, "");
+
+    manager.Connect();
+
+    for (auto _ : state) {
+        if (auto err = channel->Write(data); !err.IsNone()) {
+            state.SkipWithError("channel write failed");
+
+            break;
+        }
+    }
+
+    manager.Stop();
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+BENCHMARK(BM_ChannelWrite)->Arg(64)->Arg(4 * 1024)->Arg(64 * 1024);
+
+// Frame checksum verification which is skipped on TLS wrapped ports when SkipSecureChecksum is set.
+void BM_FrameChecksum(benchmark::State& state)
+{
+    const std::vector<uint8_t> data(state.range(0), 0xAA);
+
+    std::array<uint8_t, SHA256_DIGEST_LENGTH> checksum;
+
+    for (auto _ : state) {
+        SHA256(data.data(), data.size(), checksum.data());
+
+        benchmark::DoNotOptimize(checksum);
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+BENCHMARK(BM_FrameChecksum)->Arg(64)->Arg(4 * 1024)->Arg(64 * 1024);
+
+} // namespace
+
+} // namespace aos::mp::communication
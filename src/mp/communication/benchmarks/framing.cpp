@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <mp/communication/utils.hpp>
+
+namespace aos::mp::communication {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_PrepareHeader(benchmark::State& state)
+{
+    const std::vector<uint8_t> data(state.range(0), 0xAA);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(PrepareHeader(1, data));
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+BENCHMARK(BM_PrepareHeader)->Arg(64)->Arg(4 * 1024)->Arg(64 * 1024);
+
+void BM_ProtobufHeader(benchmark::State& state)
+{
+    uint32_t dataSize = 0;
+
+    for (auto _ : state) {
+        auto header = PrepareProtobufHeader(dataSize++);
+
+        benchmark::DoNotOptimize(ParseProtobufHeader(header));
+    }
+}
+
+BENCHMARK(BM_ProtobufHeader);
+
+} // namespace
+
+} // namespace aos::mp::communication
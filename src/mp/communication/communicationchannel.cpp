@@ -4,7 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <thread>
+#include <algorithm>
+#include <cstring>
 
 #include <common/logger/logmodule.hpp>
 
@@ -13,12 +14,6 @@
 
 namespace aos::mp::communication {
 
-/***********************************************************************************************************************
- * Static
- **********************************************************************************************************************/
-
-std::mutex CommunicationChannel::mCommChannelMutex;
-
 /***********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
@@ -31,9 +26,11 @@ CommunicationChannel::CommunicationChannel(int port, CommChannelItf* commChan)
 
 Error CommunicationChannel::Connect()
 {
-    std::unique_lock lock {mCommChannelMutex};
+    {
+        std::unique_lock lock {mMutex};
 
-    mClose = false;
+        mClose = false;
+    }
 
     LOG_DBG() << "Connect in communication channel";
 
@@ -51,18 +48,34 @@ Error CommunicationChannel::Read(std::vector<uint8_t>& message)
 
     LOG_DBG() << "Requesting: port=" << mPort << ", size=" << message.size();
 
-    mCondVar.wait(lock, [this] { return !mReceivedMessage.empty() || mClose; });
+    mCondVar.wait(lock, [this] { return mReceivedSize != 0 || mClose; });
 
     if (mClose) {
         return ErrorEnum::eRuntime;
     }
 
-    if (mReceivedMessage.size() < message.size()) {
+    if (mReceivedSize < message.size()) {
         return ErrorEnum::eRuntime;
     }
 
-    message.assign(mReceivedMessage.begin(), mReceivedMessage.begin() + message.size());
-    mReceivedMessage.erase(mReceivedMessage.begin(), mReceivedMessage.begin() + message.size());
+    size_t copied = 0;
+
+    while (copied < message.size()) {
+        const auto& chunk = mReceivedChunks.front();
+        auto        size  = std::min(chunk.size() - mReceivedOffset, message.size() - copied);
+
+        std::memcpy(message.data() + copied, chunk.data() + mReceivedOffset, size);
+
+        copied += size;
+        mReceivedOffset += size;
+
+        if (mReceivedOffset == chunk.size()) {
+            mReceivedChunks.pop_front();
+            mReceivedOffset = 0;
+        }
+    }
+
+    mReceivedSize -= message.size();
 
     return ErrorEnum::eNone;
 }
@@ -76,20 +89,17 @@ Error CommunicationChannel::Write(std::vector<uint8_t> message)
         }
     }
 
-    std::unique_lock lock {mCommChannelMutex};
-
     LOG_DBG() << "Write data: port=" << mPort << ", size=" << message.size();
 
-    auto header = PrepareHeader(mPort, message);
-    if (header.empty()) {
+    auto frame = PrepareHeader(mPort, message);
+    if (frame.empty()) {
         return Error(ErrorEnum::eRuntime, "failed to prepare header");
     }
 
-    if (auto err = mCommChannel->Write(std::move(header)); !err.IsNone()) {
-        return err;
-    }
+    frame.reserve(frame.size() + message.size());
+    frame.insert(frame.end(), message.begin(), message.end());
 
-    return mCommChannel->Write(std::move(message));
+    return mCommChannel->Write(std::move(frame));
 }
 
 Error CommunicationChannel::Close()
@@ -105,7 +115,9 @@ Error CommunicationChannel::Close()
 
         mClose = true;
 
-        mReceivedMessage.clear();
+        mReceivedChunks.clear();
+        mReceivedOffset = 0;
+        mReceivedSize   = 0;
     }
 
     mCondVar.notify_all();
@@ -115,9 +127,14 @@ Error CommunicationChannel::Close()
 
 Error CommunicationChannel::Receive(std::vector<uint8_t> message)
 {
+    if (message.empty()) {
+        return ErrorEnum::eNone;
+    }
+
     std::unique_lock lock {mMutex};
 
-    mReceivedMessage.insert(mReceivedMessage.end(), message.begin(), message.end());
+    mReceivedSize += message.size();
+    mReceivedChunks.push_back(std::move(message));
     mCondVar.notify_all();
 
     return ErrorEnum::eNone;
@@ -8,6 +8,7 @@
 #define AOS_MP_COMMUNICATION_COMMUNICATIONCHANNEL_HPP_
 
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <vector>
 
@@ -17,6 +18,10 @@ namespace aos::mp::communication {
 
 /**
  * Communication channel class.
+ *
+ * Each message is written to the underlying channel as a single frame (header + body), so writes from different ports
+ * can't interleave and no cross-channel lock is needed. Received messages are kept as a chain of buffers and consumed
+ * by advancing a read offset.
  */
 class CommunicationChannel : public CommChannelItf {
 public:
@@ -72,15 +77,14 @@ public:
     bool IsConnected() const override;
 
 private:
-    // Global mutex for synchronization communication channel
-    static std::mutex mCommChannelMutex;
-
-    CommChannelItf*         mCommChannel {};
-    int                     mPort {-1};
-    bool                    mClose {false};
-    std::vector<uint8_t>    mReceivedMessage;
-    std::mutex              mMutex;
-    std::condition_variable mCondVar;
+    CommChannelItf*                  mCommChannel {};
+    int                              mPort {-1};
+    bool                             mClose {false};
+    std::deque<std::vector<uint8_t>> mReceivedChunks;
+    size_t                           mReceivedOffset {};
+    size_t                           mReceivedSize {};
+    std::mutex                       mMutex;
+    std::condition_variable          mCondVar;
 };
 
 } // namespace aos::mp::communication
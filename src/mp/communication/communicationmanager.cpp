@@ -20,10 +20,7 @@ namespace aos::mp::communication {
 
 static void CalculateChecksum(const std::vector<uint8_t>& data, uint8_t* checksum)
 {
-    SHA256_CTX sha256;
-    SHA256_Init(&sha256);
-    SHA256_Update(&sha256, data.data(), data.size());
-    SHA256_Final(checksum, &sha256);
+    SHA256(data.data(), data.size(), checksum);
 }
 
 /***********************************************************************************************************************
@@ -90,6 +87,10 @@ std::shared_ptr<CommChannelItf> CommunicationManager::CreateChannel(
         return chan;
     }
 
+    if (mCfg->mSkipSecureChecksum) {
+        mSkipChecksumPorts.insert(port);
+    }
+
     LOG_DBG() << "Create secure channel: port=" << port << ", certStorage=" << certStorage.c_str();
 
     auto securechannel = std::make_shared<SecureChannel>(
@@ -224,10 +225,11 @@ Error CommunicationManager::ReadHandler()
 {
     LOG_DBG() << "Read handler communication manager";
 
-    while (!mShutdown) {
-        std::vector<uint8_t> headerBuffer(sizeof(AosProtocolHeader));
-        auto                 err = mTransport->Read(headerBuffer);
+    std::vector<uint8_t>                      headerBuffer(sizeof(AosProtocolHeader));
+    std::array<uint8_t, SHA256_DIGEST_LENGTH> checksum;
 
+    while (!mShutdown) {
+        auto err = mTransport->Read(headerBuffer);
         if (!err.IsNone()) {
             return err;
         }
@@ -253,23 +255,26 @@ Error CommunicationManager::ReadHandler()
 
         LOG_DBG() << "Received message: port=" << port << ", size=" << message.size();
 
-        std::array<uint8_t, SHA256_DIGEST_LENGTH> checksum;
-
-        CalculateChecksum(message, checksum.data());
+        // Frames of TLS wrapped ports are already integrity protected by TLS records. The ports are set before start,
+        // so they are read without the lock which is held by blocking writes.
+        if (mSkipChecksumPorts.find(port) == mSkipChecksumPorts.end()) {
+            CalculateChecksum(message, checksum.data());
 
-        if (std::memcmp(checksum.data(), header.mCheckSum, SHA256_DIGEST_LENGTH) != 0) {
-            LOG_ERR() << "Checksum mismatch";
+            if (std::memcmp(checksum.data(), header.mCheckSum, SHA256_DIGEST_LENGTH) != 0) {
+                LOG_ERR() << "Checksum mismatch";
 
-            continue;
+                continue;
+            }
         }
 
-        if (mChannels.find(port) == mChannels.end()) {
+        auto it = mChannels.find(port);
+        if (it == mChannels.end()) {
             LOG_ERR() << "Channel not found: port=" << port;
 
             continue;
         }
 
-        if (err = mChannels[port]->Receive(std::move(message)); !err.IsNone()) {
+        if (err = it->second->Receive(std::move(message)); !err.IsNone()) {
             return err;
         }
     }
@@ -12,6 +12,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
 
 #include <mp/config/config.hpp>
@@ -63,7 +64,7 @@ public:
     Error Stop();
 
     /**
-     * Creates communication channel.
+     * Creates communication channel. Channels should be created before the communication manager is started.
      *
      * @param port Port
      * @param certProvider Certificate provider
@@ -129,6 +130,7 @@ private:
     crypto::x509::ProviderItf*                           mCryptoProvider {};
     const config::Config*                                mCfg {};
     std::map<int, std::shared_ptr<CommunicationChannel>> mChannels;
+    std::set<int>                                        mSkipChecksumPorts;
     std::thread                                          mThread;
     std::atomic<bool>                                    mShutdown {};
     std::atomic<bool>                                    mIsConnected {};
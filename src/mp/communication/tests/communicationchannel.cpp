@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <mp/communication/communicationchannel.hpp>
+#include <mp/communication/utils.hpp>
+
+using namespace testing;
+
+namespace aos::mp::communication {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Stubs
+ **********************************************************************************************************************/
+
+class CommChannelStub : public CommChannelItf {
+public:
+    Error Connect() override { return ErrorEnum::eNone; }
+    Error Read([[maybe_unused]] std::vector<uint8_t>& message) override { return ErrorEnum::eNotSupported; }
+    Error Close() override { return ErrorEnum::eNone; }
+    bool  IsConnected() const override { return true; }
+
+    Error Write(std::vector<uint8_t> message) override
+    {
+        mWrites.push_back(std::move(message));
+
+        return ErrorEnum::eNone;
+    }
+
+    std::vector<std::vector<uint8_t>> mWrites;
+};
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class CommunicationChannelTest : public Test {
+protected:
+    void SetUp() override { tests::utils::InitLog(); }
+
+    CommChannelStub      mCommChannel;
+    CommunicationChannel mChannel {cPort, &mCommChannel};
+
+    static constexpr int cPort = 8080;
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(CommunicationChannelTest, WriteSendsSingleFrame)
+{
+    std::vector<uint8_t> message {1, 2, 3, 4, 5};
+
+    ASSERT_TRUE(mChannel.Write(message).IsNone());
+    ASSERT_EQ(mCommChannel.mWrites.size(), 1);
+
+    const auto& frame = mCommChannel.mWrites.front();
+
+    ASSERT_EQ(frame.size(), cHeaderSize + message.size());
+
+    AosProtocolHeader header {};
+
+    std::memcpy(&header, frame.data(), cHeaderSize);
+
+    EXPECT_EQ(header.mPort, static_cast<uint32_t>(cPort));
+    EXPECT_EQ(header.mDataSize, message.size());
+    EXPECT_EQ(std::vector<uint8_t>(frame.begin() + cHeaderSize, frame.end()), message);
+}
+
+TEST_F(CommunicationChannelTest, ReadAcrossReceivedChunks)
+{
+    ASSERT_TRUE(mChannel.Receive({1, 2, 3}).IsNone());
+    ASSERT_TRUE(mChannel.Receive({4, 5}).IsNone());
+    ASSERT_TRUE(mChannel.Receive({6, 7, 8, 9}).IsNone());
+
+    std::vector<uint8_t> message(2);
+
+    ASSERT_TRUE(mChannel.Read(message).IsNone());
+    EXPECT_EQ(message, std::vector<uint8_t>({1, 2}));
+
+    message.resize(4);
+
+    ASSERT_TRUE(mChannel.Read(message).IsNone());
+    EXPECT_EQ(message, std::vector<uint8_t>({3, 4, 5, 6}));
+
+    message.resize(4);
+
+    EXPECT_FALSE(mChannel.Read(message).IsNone());
+
+    message.resize(3);
+
+    ASSERT_TRUE(mChannel.Read(message).IsNone());
+    EXPECT_EQ(message, std::vector<uint8_t>({7, 8, 9}));
+}
+
+TEST_F(CommunicationChannelTest, CloseDropsReceivedData)
+{
+    ASSERT_TRUE(mChannel.Receive({1, 2, 3}).IsNone());
+    ASSERT_TRUE(mChannel.Close().IsNone());
+
+    std::vector<uint8_t> message(3);
+
+    EXPECT_FALSE(mChannel.Read(message).IsNone());
+}
+
+} // namespace aos::mp::communication
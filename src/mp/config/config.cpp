@@ -123,15 +123,16 @@ RetWithError<Config> ParseConfig(const std::string& filename)
     try {
         common::utils::CaseInsensitiveObjectWrapper object(result.mValue.extract<Poco::JSON::Object::Ptr>());
 
-        config.mWorkingDir    = object.GetValue<std::string>("WorkingDir");
-        config.mVChan         = ParseVChanConfig(object.GetObject("VChan"));
-        config.mCMConfig      = ParseCMConfig(object.GetObject("CMConfig"));
-        config.mCertStorage   = object.GetValue<std::string>("CertStorage");
-        config.mCACert        = object.GetValue<std::string>("CACert");
-        config.mImageStoreDir = object.GetValue<std::string>("ImageStoreDir");
-        config.mDownload      = ParseDownloader(object.GetObject("Downloader"));
-        config.mIAMConfig     = ParseIAMConfig(object.GetObject("IAMConfig"));
-        config.mLogConfig     = ParseLogProviderConfig(object);
+        config.mWorkingDir         = object.GetValue<std::string>("WorkingDir");
+        config.mVChan              = ParseVChanConfig(object.GetObject("VChan"));
+        config.mCMConfig           = ParseCMConfig(object.GetObject("CMConfig"));
+        config.mCertStorage        = object.GetValue<std::string>("CertStorage");
+        config.mCACert             = object.GetValue<std::string>("CACert");
+        config.mImageStoreDir      = object.GetValue<std::string>("ImageStoreDir");
+        config.mSkipSecureChecksum = object.GetValue<bool>("SkipSecureChecksum");
+        config.mDownload           = ParseDownloader(object.GetObject("Downloader"));
+        config.mIAMConfig          = ParseIAMConfig(object.GetObject("IAMConfig"));
+        config.mLogConfig          = ParseLogProviderConfig(object);
     } catch (const std::exception& e) {
         return {config, Error(ErrorEnum::eFailed, e.what())};
     }
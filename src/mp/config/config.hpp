@@ -72,6 +72,7 @@ struct Config {
     std::string          mCertStorage;
     std::string          mCACert;
     std::string          mImageStoreDir;
+    bool                 mSkipSecureChecksum {};
     Download             mDownload;
     IAMConfig            mIAMConfig;
     aos::logging::Config mLogConfig;
@@ -50,6 +50,7 @@ protected:
             "CertStorage": "sm",
             "WorkingDir": "/path/to/download",
             "ImageStoreDir": "/path/to/images",
+            "SkipSecureChecksum": true,
             "IAMConfig": {
                 "IAMPublicServerURL": "localhost:8090",
                 "IAMMainPublicServerURL": "main:8090",
@@ -98,6 +99,7 @@ TEST_F(ConfigTest, ParseConfig)
     EXPECT_EQ(config.mCertStorage, "sm");
     EXPECT_EQ(config.mWorkingDir, "/path/to/download");
     EXPECT_EQ(config.mImageStoreDir, "/path/to/images");
+    EXPECT_TRUE(config.mSkipSecureChecksum);
 
     EXPECT_EQ(config.mIAMConfig.mIAMPublicServerURL, "localhost:8090");
     EXPECT_EQ(config.mIAMConfig.mIAMMainPublicServerURL, "main:8090");
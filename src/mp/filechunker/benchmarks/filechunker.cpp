@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include <benchmark/benchmark.h>
+
+#include <mp/filechunker/filechunker.hpp>
+
+namespace aos::mp::filechunker {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+const auto cTestDir = std::filesystem::temp_directory_path() / "aos_filechunker_benchmark";
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_ChunkFiles(benchmark::State& state)
+{
+    const auto fileSize = static_cast<size_t>(state.range(0));
+
+    std::filesystem::remove_all(cTestDir);
+    std::filesystem::create_directories(cTestDir);
+
+    std::ofstream(cTestDir / "image.bin") << std::string(fileSize, 'a');
+
+    uint64_t requestID = 0;
+
+    for (auto _ : state) {
+        auto [content, err] = ChunkFiles(cTestDir.string(), requestID++);
+        if (!err.IsNone()) {
+            state.SkipWithError("can't chunk files");
+
+            break;
+        }
+
+        benchmark::DoNotOptimize(content);
+    }
+
+    state.SetBytesProcessed(state.iterations() * fileSize);
+
+    std::filesystem::remove_all(cTestDir);
+}
+
+BENCHMARK(BM_ChunkFiles)->Arg(64 * 1024)->Arg(16 * 1024 * 1024)->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+} // namespace aos::mp::filechunker
@@ -7,6 +7,8 @@
 #include <core/common/tools/logger.hpp>
 
 #include <common/utils/exception.hpp>
+#include <common/utils/exec.hpp>
+#include <common/utils/startuporchestrator.hpp>
 #include <common/version/version.hpp>
 #include <sm/config/config.hpp>
 
@@ -31,233 +33,237 @@ void AosCore::Init(const std::string& configFile)
     err = config::ParseConfig(configFile.empty() ? cDefaultConfigFile : configFile, mConfig);
     AOS_ERROR_CHECK_AND_THROW(err, "can't parse config");
 
-    // Initialize crypto provider
+    common::utils::SetMaxConcurrentExecs(mConfig.mMaxConcurrentExecs);
 
-    err = mCryptoProvider.Init(mAllocator);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize crypto provider");
+    // Modules are initialized concurrently, each step depends on the modules it uses during initialization.
 
-    // Initialize PKCS11 manager
+    common::utils::StartupOrchestrator orchestrator("SM init");
 
-    err = mPKCS11Manager.Init(mAllocator);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize PKCS11 manager");
+    auto addStep = [&orchestrator](const std::string& name, common::utils::StartupOrchestrator::Step step,
+                       const std::vector<std::string>& dependencies = {}) {
+        auto err = orchestrator.AddStep(name, std::move(step), dependencies);
+        AOS_ERROR_CHECK_AND_THROW(err, "can't add init step");
+    };
 
-    // Initialize cert loader
-
-    err = mCertLoader.Init(mAllocator, mCryptoProvider, mPKCS11Manager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize cert loader");
-
-    // Initialize TLS credentials
-
-    err = mTLSCredentials.Init(mConfig.mIAMClientConfig.mCACert, mIAMClient, mCertLoader, mCryptoProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize TLS credentials");
-
-    // Initialize IAM client
-
-    err = mIAMClient.Init(mConfig.mIAMProtectedServerURL, mConfig.mIAMClientConfig.mIAMPublicServerURL,
-        mConfig.mCertStorage, mTLSCredentials, "sm");
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize IAM client");
-
-    // NodeInfo nodeInfo;
     auto nodeInfo = std::make_unique<NodeInfo>();
+    auto runtimes = std::make_unique<StaticArray<launcher::RuntimeItf*, cMaxNumNodeRuntimes>>();
 
-    err = mIAMClient.GetCurrentNodeInfo(*nodeInfo);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't get node info");
-
-    // Initialize resource manager
-
-    err = mResourceManager.Init({mConfig.mResourcesConfigFile.c_str()});
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize resource manager");
-
-    // Initialize database
-
-    err = mDatabase.Init(mConfig.mWorkingDir, mConfig.mMigration);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize database");
+    // Allocator is thread safe: modules allocate from it concurrently at runtime, so steps using it are not ordered.
+    // Crypto provider, PKCS11 manager and cert loader set up crypto and PKCS11 library state which is not reentrant,
+    // these steps are chained.
+    addStep("crypto provider", [this]() { return mCryptoProvider.Init(mAllocator); });
+    addStep(
+        "PKCS11 manager", [this]() { return mPKCS11Manager.Init(mAllocator); }, {"crypto provider"});
+    addStep(
+        "cert loader", [this]() { return mCertLoader.Init(mAllocator, mCryptoProvider, mPKCS11Manager); },
+        {"crypto provider", "PKCS11 manager"});
+    addStep(
+        "TLS credentials",
+        [this]() {
+            return mTLSCredentials.Init(mConfig.mIAMClientConfig.mCACert, mIAMClient, mCertLoader, mCryptoProvider);
+        },
+        {"cert loader"});
+    addStep(
+        "IAM client",
+        [this, &nodeInfo]() {
+            if (auto err = mIAMClient.Init(mConfig.mIAMProtectedServerURL, mConfig.mIAMClientConfig.mIAMPublicServerURL,
+                    mConfig.mCertStorage, mTLSCredentials, "sm");
+                !err.IsNone()) {
+                return err;
+            }
+
+            return mIAMClient.GetCurrentNodeInfo(*nodeInfo);
+        },
+        {"TLS credentials"});
+    addStep("resource manager", [this]() { return mResourceManager.Init({mConfig.mResourcesConfigFile.c_str()}); });
+    addStep("database", [this]() { return mDatabase.Init(mConfig.mWorkingDir, mConfig.mMigration); });
 
     // Initialize network manager
 
-    err = mNetworkInterfaceManager.Init(mCryptoProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize network interface manager");
-
-    err = mNamespaceManager.Init(mNetworkInterfaceManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize namespace manager");
-
-    err = mFirewall.Init(mNFTables);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize firewall");
-
-    err = mBridgeNetwork.Init(mNetworkInterfaceManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize bridge network");
-
-    err = mBandwidth.Init(mTC, mNetworkInterfaceManager, mNetworkInterfaceManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize bandwidth");
-
-    err = mDNSName.Init(mConfig.mWorkingDir + "/dns", mProcessSpawner);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize DNS name");
-
-    err = mTrafficMonitor.Init(mDatabase, mNFTables);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize traffic monitor");
-
-    err = mNetworkManager.Init(mAllocator, mDatabase, mBridgeNetwork, mFirewall, mBandwidth, mDNSName, mTrafficMonitor,
-        mNamespaceManager, mNetworkInterfaceManager, mCryptoProvider, mNetworkInterfaceManager, mSMClient,
-        nodeInfo->mNodeID.CStr());
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize network manager");
+    addStep(
+        "network interface manager", [this]() { return mNetworkInterfaceManager.Init(mCryptoProvider); },
+        {"crypto provider"});
+    addStep(
+        "namespace manager", [this]() { return mNamespaceManager.Init(mNetworkInterfaceManager); },
+        {"network interface manager"});
+    addStep("firewall", [this]() { return mFirewall.Init(mNFTables); });
+    addStep(
+        "bridge network", [this]() { return mBridgeNetwork.Init(mNetworkInterfaceManager); },
+        {"network interface manager"});
+    addStep(
+        "bandwidth", [this]() { return mBandwidth.Init(mTC, mNetworkInterfaceManager, mNetworkInterfaceManager); },
+        {"network interface manager"});
+    addStep("DNS name", [this]() { return mDNSName.Init(mConfig.mWorkingDir + "/dns", mProcessSpawner); });
+    addStep(
+        "traffic monitor", [this]() { return mTrafficMonitor.Init(mDatabase, mNFTables); }, {"database"});
+    addStep(
+        "network manager",
+        [this, &nodeInfo]() {
+            return mNetworkManager.Init(mAllocator, mDatabase, mBridgeNetwork, mFirewall, mBandwidth, mDNSName,
+                mTrafficMonitor, mNamespaceManager, mNetworkInterfaceManager, mCryptoProvider, mNetworkInterfaceManager,
+                mSMClient, nodeInfo->mNodeID.CStr());
+        },
+        {"IAM client", "database", "namespace manager", "firewall", "bridge network", "bandwidth", "DNS name",
+            "traffic monitor"});
 
     // Initialize node monitoring provider
 
-    err = mNodeMonitoringProvider.Init(mIAMClient, mNetworkManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize node monitoring provider");
+    addStep(
+        "node monitoring provider", [this]() { return mNodeMonitoringProvider.Init(mIAMClient, mNetworkManager); },
+        {"IAM client", "network manager"});
 
     // Initialize runtimes
 
-    err = mRuntimes.Init(mConfig.mLauncher, mIAMClient, mImageManager, mNetworkManager, mIAMClient, mResourceManager,
-        mOCISpec, mLauncher, mSystemdConn, mInstanceIDProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize runtimes");
-
-    auto runtimes = std::make_unique<StaticArray<launcher::RuntimeItf*, cMaxNumNodeRuntimes>>();
-
-    err = mRuntimes.GetRuntimes(*runtimes);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't get runtimes");
-
-    // Initialize images space allocator
-
-    err = mImagesSpaceAllocator.Init(mAllocator, mConfig.mImageManager.mImagePath, mPlatformFS, 0, &mImageManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize images space allocator");
+    addStep(
+        "runtimes",
+        [this, &runtimes]() {
+            if (auto err = mRuntimes.Init(mConfig.mLauncher, mIAMClient, mImageManager, mNetworkManager, mIAMClient,
+                    mResourceManager, mOCISpec, mLauncher, mSystemdConn, mInstanceIDProvider);
+                !err.IsNone()) {
+                return err;
+            }
 
-    // Initialize downloader
-
-    err = mDownloader.Init();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize downloader");
-
-    // Initialize file info provider
-
-    err = mFileInfoProvider.Init(mAllocator, mCryptoProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize file info provider");
-
-    // Initialize image handler
-    err = mImageHandler.Init();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize image handler");
+            return mRuntimes.GetRuntimes(*runtimes);
+        },
+        {"IAM client", "network manager", "resource manager"});
 
     // Initialize image manager
 
-    err = mImageManager.Init(mAllocator, mConfig.mImageManager, mSMClient, mImagesSpaceAllocator, mDownloader,
-        mFileInfoProvider, mOCISpec, mImageHandler, mDatabase);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize image manager");
+    addStep("images space allocator", [this]() {
+        return mImagesSpaceAllocator.Init(mAllocator, mConfig.mImageManager.mImagePath, mPlatformFS, 0, &mImageManager);
+    });
+    addStep("downloader", [this]() { return mDownloader.Init(); });
+    addStep(
+        "file info provider", [this]() { return mFileInfoProvider.Init(mAllocator, mCryptoProvider); },
+        {"crypto provider"});
+    addStep("image handler", [this]() { return mImageHandler.Init(); });
+    addStep(
+        "image manager",
+        [this]() {
+            return mImageManager.Init(mAllocator, mConfig.mImageManager, mSMClient, mImagesSpaceAllocator, mDownloader,
+                mFileInfoProvider, mOCISpec, mImageHandler, mDatabase);
+        },
+        {"images space allocator", "downloader", "file info provider", "image handler", "database"});
 
     // Initialize launcher
 
-    err = mLauncher.Init(mAllocator, *runtimes, mImageManager, mSMClient, mDatabase, mOCISpec, mImageManager, mSMClient,
-        mNetworkManager, mInstanceIDProvider, mResourceManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize launcher");
-
-    // Initialize node config handler
-
-    err = mNodeConfigHandler.Init(mAllocator, {mConfig.mNodeConfigFile.c_str()}, mJSONProvider);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize node config handler");
+    addStep(
+        "launcher",
+        [this, &runtimes]() {
+            return mLauncher.Init(mAllocator, *runtimes, mImageManager, mSMClient, mDatabase, mOCISpec, mImageManager,
+                mSMClient, mNetworkManager, mInstanceIDProvider, mResourceManager);
+        },
+        {"runtimes", "image manager", "database", "network manager", "resource manager"});
 
     // Initialize monitoring
 
-    err = mMonitoring.Init(mAllocator, mConfig.mMonitoring, mNodeConfigHandler, mIAMClient, mSMClient, mSMClient,
-        mNodeMonitoringProvider, &mLauncher);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize monitoring");
-
-    // Initialize logprovider
-
-    err = mLogProvider.Init(mConfig.mLogging, mRuntimes.GetContainerRuntime(), mSMClient);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize logprovider");
+    addStep("node config handler", [this]() {
+        return mNodeConfigHandler.Init(mAllocator, {mConfig.mNodeConfigFile.c_str()}, mJSONProvider);
+    });
+    addStep(
+        "monitoring",
+        [this]() {
+            return mMonitoring.Init(mAllocator, mConfig.mMonitoring, mNodeConfigHandler, mIAMClient, mSMClient,
+                mSMClient, mNodeMonitoringProvider, &mLauncher);
+        },
+        {"node config handler", "IAM client", "node monitoring provider", "launcher"});
+    addStep(
+        "logprovider",
+        [this]() { return mLogProvider.Init(mConfig.mLogging, mRuntimes.GetContainerRuntime(), mSMClient); },
+        {"runtimes"});
 
     // Initialize SM client
 
-    err = mSMClient.Init(mConfig.mSMClientConfig, nodeInfo->mNodeID.CStr(), mTLSCredentials, mIAMClient, mLauncher,
-        mResourceManager, mNodeConfigHandler, mLauncher, mLogProvider, mMonitoring, mLauncher, mJSONProvider,
-        mNetworkManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize SM client");
+    addStep(
+        "SM client",
+        [this, &nodeInfo]() {
+            return mSMClient.Init(mConfig.mSMClientConfig, nodeInfo->mNodeID.CStr(), mTLSCredentials, mIAMClient,
+                mLauncher, mResourceManager, mNodeConfigHandler, mLauncher, mLogProvider, mMonitoring, mLauncher,
+                mJSONProvider, mNetworkManager);
+        },
+        {"TLS credentials", "IAM client", "launcher", "resource manager", "node config handler", "monitoring",
+            "logprovider", "network manager"});
+    addStep(
+        "journalalerts", [this]() { return mJournalAlerts.Init(mConfig.mJournalAlerts, mDatabase, mSMClient); },
+        {"database", "SM client"});
+
+    err = orchestrator.Run();
 
-    // Initialize journalalerts
+    orchestrator.LogTimings();
 
-    err = mJournalAlerts.Init(mConfig.mJournalAlerts, mDatabase, mSMClient);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize journalalerts");
+    AOS_ERROR_CHECK_AND_THROW(err, "can't initialize SM");
 }
 
 void AosCore::Start()
 {
-    auto err = mNetworkManager.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start network manager");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mNetworkManager.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop network manager: err=" << err;
-        }
-    });
-
-    err = mImageManager.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start image manager");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mImageManager.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop image manager: err=" << err;
-        }
-    });
-
-    err = mLauncher.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start launcher");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mLauncher.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop launcher: err=" << err;
-        }
-    });
-
-    err = mNodeMonitoringProvider.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start node monitoring provider");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mNodeMonitoringProvider.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop node monitoring provider: err=" << err;
-        }
-    });
-
-    err = mMonitoring.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start monitoring");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mMonitoring.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop monitoring: err=" << err;
-        }
-    });
-
-    err = mLogProvider.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start logprovider");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mLogProvider.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop logprovider: err=" << err;
-        }
-    });
-
-    err = mJournalAlerts.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start journalalerts");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mJournalAlerts.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop journalalerts: err=" << err;
-        }
-    });
-
-    // ConnectListener must be subscribed before Start() to not miss the first OnConnect.
-    err = mSMClient.SubscribeListener(mNetworkManager);
-    AOS_ERROR_CHECK_AND_THROW(err, "can't subscribe connect listener");
-
-    err = mSMClient.Start();
-    AOS_ERROR_CHECK_AND_THROW(err, "can't start SM client");
-
-    mCleanupManager.AddCleanup([this]() {
-        if (auto err = mSMClient.Stop(); !err.IsNone()) {
-            LOG_ERR() << "Can't stop SM client: err=" << err;
-        }
-
-        if (auto err = mSMClient.UnsubscribeListener(mNetworkManager); !err.IsNone()) {
-            LOG_ERR() << "Can't unsubscribe connect listener" << Log::Field(err);
-        }
-    });
+    common::utils::StartupOrchestrator orchestrator("SM start");
+
+    auto addStep = [this, &orchestrator](const std::string& name, std::function<Error()> start,
+                       std::function<Error()> stop, const std::vector<std::string>& dependencies = {}) {
+        auto step = [this, name, start = std::move(start), stop = std::move(stop)]() {
+            if (auto err = start(); !err.IsNone()) {
+                return err;
+            }
+
+            mCleanupManager.AddCleanup([name, stop]() {
+                if (auto err = stop(); !err.IsNone()) {
+                    LOG_ERR() << "Can't stop module" << Log::Field("name", name.c_str()) << Log::Field(err);
+                }
+            });
+
+            return Error(ErrorEnum::eNone);
+        };
+
+        auto err = orchestrator.AddStep(name, std::move(step), dependencies);
+        AOS_ERROR_CHECK_AND_THROW(err, "can't add start step");
+    };
+
+    addStep(
+        "network manager", [this]() { return mNetworkManager.Start(); }, [this]() { return mNetworkManager.Stop(); });
+    addStep(
+        "image manager", [this]() { return mImageManager.Start(); }, [this]() { return mImageManager.Stop(); });
+    addStep(
+        "launcher", [this]() { return mLauncher.Start(); }, [this]() { return mLauncher.Stop(); },
+        {"network manager", "image manager"});
+    addStep(
+        "node monitoring provider", [this]() { return mNodeMonitoringProvider.Start(); },
+        [this]() { return mNodeMonitoringProvider.Stop(); }, {"network manager"});
+    addStep(
+        "monitoring", [this]() { return mMonitoring.Start(); }, [this]() { return mMonitoring.Stop(); },
+        {"node monitoring provider", "launcher"});
+    addStep(
+        "logprovider", [this]() { return mLogProvider.Start(); }, [this]() { return mLogProvider.Stop(); });
+    addStep(
+        "journalalerts", [this]() { return mJournalAlerts.Start(); }, [this]() { return mJournalAlerts.Stop(); });
+
+    // SM client is started last: once connected, CM expects all modules to be running.
+    addStep(
+        "SM client",
+        [this]() {
+            // ConnectListener must be subscribed before Start() to not miss the first OnConnect.
+            if (auto err = mSMClient.SubscribeListener(mNetworkManager); !err.IsNone()) {
+                return err;
+            }
+
+            return mSMClient.Start();
+        },
+        [this]() {
+            auto err = mSMClient.Stop();
+
+            if (auto unsubscribeErr = mSMClient.UnsubscribeListener(mNetworkManager); !unsubscribeErr.IsNone()) {
+                LOG_ERR() << "Can't unsubscribe connect listener" << Log::Field(unsubscribeErr);
+            }
+
+            return err;
+        },
+        {"network manager", "image manager", "launcher", "node monitoring provider", "monitoring", "logprovider",
+            "journalalerts"});
+
+    auto err = orchestrator.Run();
+
+    orchestrator.LogTimings();
+
+    AOS_ERROR_CHECK_AND_THROW(err, "can't start SM");
 }
 
 void AosCore::Stop()
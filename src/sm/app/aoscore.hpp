@@ -85,6 +85,7 @@ public:
     void SetLogLevel(aos::LogLevel level);
 
 private:
+    // Shared by all modules, thread safe.
     aos::HeapAllocator mAllocator;
 
     config::Config mConfig = {};
@@ -12,9 +12,11 @@
 #include <Poco/Util/HelpFormatter.h>
 #include <systemd/sd-daemon.h>
 
+#include <core/common/tools/logger.hpp>
 #include <core/common/version/version.hpp>
 
 #include <common/utils/exception.hpp>
+#include <common/utils/tracer.hpp>
 #include <common/version/version.hpp>
 
 #include "app.hpp"
@@ -112,11 +114,17 @@ void App::uninitialize()
 {
     Application::uninitialize();
 
-    if (!mInitialized) {
-        return;
+    if (mInitialized) {
+        mAosCore->Stop();
     }
 
-    mAosCore->Stop();
+    if (common::utils::Tracer::IsEnabled()) {
+        if (auto err = common::utils::Tracer::Get().Dump(); !err.IsNone()) {
+            LOG_ERR() << "Can't dump trace" << Log::Field(err);
+        }
+
+        common::utils::Tracer::Get().Disable();
+    }
 }
 
 void App::reinitialize(Application& self)
@@ -153,6 +161,9 @@ void App::defineOptions(Poco::Util::OptionSet& options)
     options.addOption(Poco::Util::Option("config", "c", "path to config file")
                           .argument("${file}")
                           .callback(Poco::Util::OptionCallback<App>(this, &App::HandleConfigFile)));
+    options.addOption(Poco::Util::Option("trace", "t", "enables tracing, trace is dumped on SIGUSR1 and on exit")
+                          .argument("${file}")
+                          .callback(Poco::Util::OptionCallback<App>(this, &App::HandleTrace)));
 }
 
 /***********************************************************************************************************************
@@ -218,4 +229,13 @@ void App::HandleConfigFile(const std::string& name, const std::string& value)
     mConfigFile = value;
 }
 
+void App::HandleTrace(const std::string& name, const std::string& value)
+{
+    (void)name;
+
+    if (auto err = common::utils::Tracer::Get().Enable(value); !err.IsNone()) {
+        throw Poco::Exception("can't enable tracing", value);
+    }
+}
+
 } // namespace aos::sm::app
@@ -32,6 +32,7 @@ private:
     void HandleJournal(const std::string& name, const std::string& value);
     void HandleLogLevel(const std::string& name, const std::string& value);
     void HandleConfigFile(const std::string& name, const std::string& value);
+    void HandleTrace(const std::string& name, const std::string& value);
 
     bool                     mStopProcessing = false;
     bool                     mInitialized    = false;
@@ -126,6 +126,8 @@ Error ParseConfig(const std::string& filename, Config& config)
         config.mResourcesConfigFile
             = object.GetOptionalValue<std::string>("resourcesConfigFile").value_or(cResourceConfigFileName);
 
+        config.mMaxConcurrentExecs = object.GetValue<size_t>("maxConcurrentExecs", 0);
+
         auto empty = common::utils::CaseInsensitiveObjectWrapper(Poco::makeShared<Poco::JSON::Object>());
 
         common::config::ParseMonitoringConfig(
@@ -38,6 +38,7 @@ struct Config {
     std::string                   mNodeConfigFile;
     std::string                   mResourcesConfigFile;
     std::string                   mWorkingDir;
+    size_t                        mMaxConcurrentExecs {};
     common::config::JournalAlerts mJournalAlerts;
     common::config::Migration     mMigration;
     common::iamclient::Config     mIAMClientConfig;
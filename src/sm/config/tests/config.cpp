@@ -67,6 +67,7 @@ static constexpr auto cTestServiceManagerJSON          = R"({
         "maxPartCount": 10,
         "maxPartSize": 1024
     },
+    "maxConcurrentExecs": 4,
     "migration": {
         "mergedMigrationPath": "/var/aos/servicemanager/mergedMigration",
         "migrationPath": "/usr/share/aos_servicemanager/migration"
@@ -195,6 +196,7 @@ TEST_F(ConfigTest, ParseConfig)
     EXPECT_EQ(config->mNodeConfigFile, "/var/aos/aos_node.cfg");
     EXPECT_EQ(config->mResourcesConfigFile, "/var/aos/resources.cfg");
     EXPECT_EQ(config->mWorkingDir, "workingDir");
+    EXPECT_EQ(config->mMaxConcurrentExecs, 4);
 }
 
 TEST_F(ConfigTest, DefaultValuesAreUsed)
@@ -221,6 +223,7 @@ TEST_F(ConfigTest, DefaultValuesAreUsed)
 
     EXPECT_EQ(config->mNodeConfigFile, "test/aos_node.cfg");
     EXPECT_EQ(config->mResourcesConfigFile, "/etc/aos/resources.cfg");
+    EXPECT_EQ(config->mMaxConcurrentExecs, 0);
 }
 
 TEST_F(ConfigTest, ErrorReturnedOnFileMissing)
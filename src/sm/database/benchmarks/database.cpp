@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <sm/database/database.hpp>
+
+namespace aos::sm::database {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+const auto cWorkDir = std::filesystem::temp_directory_path() / "aos_database_benchmark";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+Error InitDatabase(Database& db)
+{
+    std::filesystem::remove_all(cWorkDir);
+    std::filesystem::create_directories(cWorkDir);
+
+    common::config::Migration migrationConfig;
+
+    // Migration files are taken from the source tree next to the benchmark source file.
+    migrationConfig.mMigrationPath
+        = std::filesystem::canonical(std::filesystem::path(__FILE__).parent_path() / ".." / "migration").string();
+    migrationConfig.mMergedMigrationPath = (cWorkDir / "merged-migration").string();
+
+    return db.Init(cWorkDir.string(), migrationConfig);
+}
+
+InstanceInfo CreateInstanceInfo(size_t index)
+{
+    InstanceInfo info;
+
+    info.mItemID         = ("service-" + std::to_string(index)).c_str();
+    info.mSubjectID      = "subject";
+    info.mInstance       = 0;
+    info.mType           = UpdateItemTypeEnum::eService;
+    info.mVersion        = "1.0.0";
+    info.mManifestDigest = "sha256:36f028580bb02cc8272a9a020f4200e346e276ae664e45ee80745574e2f5ab80";
+    info.mRuntimeID      = "crun";
+    info.mOwnerID        = "owner";
+    info.mSubjectType    = SubjectTypeEnum::eUser;
+    info.mUID            = 5000 + index;
+    info.mGID            = 5000 + index;
+    info.mPriority       = 20;
+    info.mStoragePath    = "storage";
+    info.mStatePath      = "state";
+
+    return info;
+}
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+void BM_UpdateInstanceInfo(benchmark::State& state)
+{
+    Database db;
+
+    if (auto err = InitDatabase(db); !err.IsNone()) {
+        state.SkipWithError("can't init database");
+
+        return;
+    }
+
+    auto info = CreateInstanceInfo(0);
+
+    for (auto _ : state) {
+        info.mPriority++;
+
+        if (auto err = db.UpdateInstanceInfo(info); !err.IsNone()) {
+            state.SkipWithError("can't update instance info");
+
+            break;
+        }
+    }
+}
+
+BENCHMARK(BM_UpdateInstanceInfo)->Unit(benchmark::kMicrosecond);
+
+void BM_GetAllInstancesInfos(benchmark::State& state)
+{
+    Database db;
+
+    if (auto err = InitDatabase(db); !err.IsNone()) {
+        state.SkipWithError("can't init database");
+
+        return;
+    }
+
+    for (int64_t i = 0; i < state.range(0); i++) {
+        if (auto err = db.UpdateInstanceInfo(CreateInstanceInfo(i)); !err.IsNone()) {
+            state.SkipWithError("can't add instance info");
+
+            return;
+        }
+    }
+
+    auto infos = std::make_unique<InstanceInfoArray>();
+
+    for (auto _ : state) {
+        infos->Clear();
+
+        if (auto err = db.GetAllInstancesInfos(*infos); !err.IsNone()) {
+            state.SkipWithError("can't get instances infos");
+
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_GetAllInstancesInfos)->Arg(1)->Arg(32)->Unit(benchmark::kMicrosecond);
+
+void BM_SetTrafficMonitorData(benchmark::State& state)
+{
+    Database db;
+
+    if (auto err = InitDatabase(db); !err.IsNone()) {
+        state.SkipWithError("can't init database");
+
+        return;
+    }
+
+    uint64_t value = 0;
+
+    for (auto _ : state) {
+        if (auto err = db.SetTrafficMonitorData("AOS_SYSTEM_IN", Time::Now(), value++); !err.IsNone()) {
+            state.SkipWithError("can't set traffic monitor data");
+
+            break;
+        }
+    }
+}
+
+BENCHMARK(BM_SetTrafficMonitorData)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+
+} // namespace aos::sm::database
@@ -19,6 +19,7 @@
 
 #include <common/utils/exception.hpp>
 #include <common/utils/json.hpp>
+#include <common/utils/tracer.hpp>
 
 #include "database.hpp"
 
@@ -446,6 +447,8 @@ Error Database::Init(const std::string& workDir, const common::config::Migration
 
 Error Database::AddUpdateItem(const imagemanager::UpdateItemData& updateItem)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Add update item" << Log::Field("id", updateItem.mID) << Log::Field("type", updateItem.mType)
@@ -468,6 +471,8 @@ Error Database::AddUpdateItem(const imagemanager::UpdateItemData& updateItem)
 
 Error Database::UpdateUpdateItem(const imagemanager::UpdateItemData& updateItem)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Update update item" << Log::Field("id", updateItem.mID) << Log::Field("type", updateItem.mType)
@@ -494,6 +499,8 @@ Error Database::UpdateUpdateItem(const imagemanager::UpdateItemData& updateItem)
 
 Error Database::RemoveUpdateItem(const String& itemID, const String& version)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Remove update item" << Log::Field("id", itemID) << Log::Field("version", version);
@@ -515,6 +522,8 @@ Error Database::RemoveUpdateItem(const String& itemID, const String& version)
 
 Error Database::GetUpdateItem(const String& itemID, Array<imagemanager::UpdateItemData>& itemData)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Get update item" << Log::Field("id", itemID);
@@ -547,6 +556,8 @@ Error Database::GetUpdateItem(const String& itemID, Array<imagemanager::UpdateIt
 
 Error Database::GetAllUpdateItems(Array<imagemanager::UpdateItemData>& itemsData)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Get all update items";
@@ -577,6 +588,8 @@ Error Database::GetAllUpdateItems(Array<imagemanager::UpdateItemData>& itemsData
 
 RetWithError<size_t> Database::GetUpdateItemsCount()
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Get update items count";
@@ -599,6 +612,8 @@ RetWithError<size_t> Database::GetUpdateItemsCount()
 
 Error Database::GetAllInstancesInfos([[maybe_unused]] Array<InstanceInfo>& infos)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Get all instances infos";
@@ -630,6 +645,8 @@ Error Database::GetAllInstancesInfos([[maybe_unused]] Array<InstanceInfo>& infos
 
 Error Database::UpdateInstanceInfo(const InstanceInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Update instance info" << Log::Field("instance", static_cast<const InstanceIdent&>(info));
@@ -653,6 +670,8 @@ Error Database::UpdateInstanceInfo(const InstanceInfo& info)
 
 Error Database::RemoveInstanceInfo(const InstanceIdent& ident)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Remove instance info" << Log::Field("instance", static_cast<const InstanceIdent&>(ident));
@@ -681,6 +700,8 @@ Error Database::RemoveInstanceInfo(const InstanceIdent& ident)
 
 Error Database::RemoveNetworkInfo(const String& networkID)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Remove network" << Log::Field("networkID", networkID);
@@ -702,6 +723,8 @@ Error Database::RemoveNetworkInfo(const String& networkID)
 
 Error Database::AddNetworkInfo(const sm::networkmanager::NetworkInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Add network info" << Log::Field("networkID", info.mNetworkID);
@@ -723,6 +746,8 @@ Error Database::AddNetworkInfo(const sm::networkmanager::NetworkInfo& info)
 
 Error Database::GetNetworksInfo(Array<sm::networkmanager::NetworkInfo>& networks) const
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Get all networks";
@@ -750,6 +775,8 @@ Error Database::GetNetworksInfo(Array<sm::networkmanager::NetworkInfo>& networks
 
 Error Database::SetTrafficMonitorData(const String& chain, const Time& time, uint64_t value)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Set traffic monitor data" << Log::Field("chain", chain) << Log::Field("time", time)
@@ -767,6 +794,8 @@ Error Database::SetTrafficMonitorData(const String& chain, const Time& time, uin
 
 Error Database::GetTrafficMonitorData(const String& chain, Time& time, uint64_t& value) const
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Get traffic monitor data" << Log::Field("chain", chain);
@@ -793,6 +822,8 @@ Error Database::GetTrafficMonitorData(const String& chain, Time& time, uint64_t&
 
 Error Database::RemoveTrafficMonitorData(const String& chain)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Remove traffic monitor data" << Log::Field("chain", chain);
@@ -814,6 +845,8 @@ Error Database::RemoveTrafficMonitorData(const String& chain)
 
 Error Database::BeginTransaction()
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Begin transaction";
@@ -831,6 +864,8 @@ Error Database::BeginTransaction()
 
 Error Database::CommitTransaction()
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Commit transaction";
@@ -848,6 +883,8 @@ Error Database::CommitTransaction()
 
 Error Database::RollbackTransaction()
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Rollback transaction";
@@ -865,6 +902,8 @@ Error Database::RollbackTransaction()
 
 Error Database::AddInstanceNetworkInfo(const sm::networkmanager::InstanceNetworkInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Add instance network info" << Log::Field("instanceID", info.mInstanceID)
@@ -887,6 +926,8 @@ Error Database::AddInstanceNetworkInfo(const sm::networkmanager::InstanceNetwork
 
 Error Database::UpdateInstanceNetworkInfo(const sm::networkmanager::InstanceNetworkInfo& info)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Update instance network info" << Log::Field("instanceID", info.mInstanceID)
@@ -909,6 +950,8 @@ Error Database::UpdateInstanceNetworkInfo(const sm::networkmanager::InstanceNetw
 
 Error Database::RemoveInstanceNetworkInfo(const String& instanceID)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Remove instance network info" << Log::Field("instanceID", instanceID);
@@ -930,6 +973,8 @@ Error Database::RemoveInstanceNetworkInfo(const String& instanceID)
 
 Error Database::GetInstanceNetworksInfo(Array<sm::networkmanager::InstanceNetworkInfo>& networks) const
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Get all instance networks";
@@ -964,6 +1009,8 @@ Error Database::GetInstanceNetworksInfo(Array<sm::networkmanager::InstanceNetwor
 
 Error Database::SetJournalCursor(const String& cursor)
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     LOG_DBG() << "Set journal cursor" << Log::Field("cursor", cursor);
@@ -979,6 +1026,8 @@ Error Database::SetJournalCursor(const String& cursor)
 
 Error Database::GetJournalCursor(String& cursor) const
 {
+    AOS_TRACE_FUNCTION("db");
+
     std::lock_guard lock {mMutex};
 
     try {
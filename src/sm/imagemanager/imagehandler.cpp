@@ -14,6 +14,7 @@
 #include <common/utils/exception.hpp>
 #include <common/utils/filesystem.hpp>
 #include <common/utils/image.hpp>
+#include <common/utils/tracer.hpp>
 
 #include "imagehandler.hpp"
 
@@ -76,6 +77,8 @@ void OCIWhiteoutsToOverlay(const String& path)
 
 Error ImageHandler::UnpackLayer(const String& src, const String& dst, const String& mediaType)
 {
+    AOS_TRACE_FUNCTION("image");
+
     try {
 
         LOG_DBG() << "Unpack layer" << Log::Field("src", src) << Log::Field("dst", dst)
@@ -105,6 +108,8 @@ Error ImageHandler::UnpackLayer(const String& src, const String& dst, const Stri
 
 RetWithError<size_t> ImageHandler::GetUnpackedLayerSize(const String& path, const String& mediaType) const
 {
+    AOS_TRACE_FUNCTION("image");
+
     LOG_DBG() << "Get unpacked layer size" << Log::Field("path", path) << Log::Field("mediaType", mediaType);
 
     if (auto err = CheckMediaType(mediaType); !err.IsNone()) {
@@ -121,6 +126,8 @@ RetWithError<size_t> ImageHandler::GetUnpackedLayerSize(const String& path, cons
 
 RetWithError<StaticString<oci::cDigestLen>> ImageHandler::GetUnpackedLayerDigest(const String& path) const
 {
+    AOS_TRACE_FUNCTION("image");
+
     LOG_DBG() << "Get unpacked layer digest" << Log::Field("path", path);
 
     auto [digest, err] = common::utils::CalculateDirDigest(path.CStr());
@@ -12,8 +12,8 @@
 #include <core/common/tools/logger.hpp>
 
 #include <common/utils/exception.hpp>
-#include <common/utils/exec.hpp>
 #include <common/utils/filesystem.hpp>
+#include <common/utils/json.hpp>
 
 #include <sm/launcher/runtimes/utils/utils.hpp>
 
@@ -551,40 +551,20 @@ Error BootRuntime::InstallImageOnPartition(const oci::ImageManifest& manifest, s
         return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "image manifest has no layers"));
     }
 
-    const auto imagesDir         = GetPath(cImagesDir);
-    const auto packedImagePath   = imagesDir / "boot.img.gz";
-    const auto unpackedImagePath = imagesDir / "boot.img";
-
-    if (auto err = fs::ClearDir(imagesDir.c_str()); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
-    }
-
     StaticString<cFilePathLen> imageArchivePath;
 
     if (auto err = mItemInfoProvider->GetBlobPath(manifest.mLayers[0].mDigest, imageArchivePath); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    std::error_code ec;
-    std::filesystem::copy_file(imageArchivePath.CStr(), packedImagePath, ec);
-
-    if (ec) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, ec.message().c_str()));
-    }
-
-    if (auto res = common::utils::ExecCommand({"gunzip", packedImagePath.c_str()}); !res.mError.IsNone()) {
-        return AOS_ERROR_WRAP(res.mError);
-    }
-
-    auto cleanup = DeferRelease(&imagesDir, [](const auto* path) { fs::RemoveAll(path->c_str()); });
-
     try {
         const auto& toDevice = mPartitionDevices.at(partitionIndex);
 
-        LOG_DBG() << "Install image" << Log::Field("image", unpackedImagePath.c_str())
+        LOG_DBG() << "Install image" << Log::Field("image", imageArchivePath)
                   << Log::Field("toDevice", toDevice.c_str());
 
-        if (auto err = mPartitionManager->InstallImage(unpackedImagePath.c_str(), toDevice); !err.IsNone()) {
+        // The layer is decompressed while being written to the partition, no intermediate files are created.
+        if (auto err = mPartitionManager->InstallImage(imageArchivePath.CStr(), toDevice); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
         }
     } catch (const std::exception& e) {
@@ -622,11 +602,6 @@ Error BootRuntime::StoreData(const std::string_view filename, const BootData& da
               << Log::Field("digest", data.mManifestDigest) << Log::Field("state", data.mState)
               << Log::Field("path", path.c_str());
 
-    std::ofstream file(path);
-    if (!file.is_open()) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "can't open file"));
-    }
-
     auto json = Poco::makeShared<Poco::JSON::Object>(Poco::JSON_PRESERVE_KEY_ORDER);
 
     try {
@@ -642,12 +617,14 @@ Error BootRuntime::StoreData(const std::string_view filename, const BootData& da
         if (data.mPartitionIndex.HasValue()) {
             json->set("partitionIndex", data.mPartitionIndex.GetValue());
         }
-
-        json->stringify(file);
     } catch (const std::exception& e) {
         return AOS_ERROR_WRAP(common::utils::ToAosError(e));
     }
 
+    if (auto err = common::utils::WriteJsonToFile(json, path.string()); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
     return ErrorEnum::eNone;
 }
 
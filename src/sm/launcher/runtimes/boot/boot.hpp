@@ -125,7 +125,6 @@ private:
     static constexpr auto cNumBootPartitions = 2;
     static constexpr auto cInstalledInstance = "installed.json";
     static constexpr auto cPendingInstance   = "pending.json";
-    static constexpr auto cImagesDir         = "images";
     static constexpr auto cMountDirName      = "mnt";
     static constexpr auto cUpdateStateFile   = "update.state";
     static constexpr auto cMaxNumInstances   = 1;
@@ -96,9 +96,9 @@ public:
     virtual Error CopyDevice(const std::string& src, const std::string& dst) const = 0;
 
     /**
-     * Copies image to device.
+     * Decompresses gzip image to device.
      *
-     * @param image image path.
+     * @param image gzip compressed image path.
      * @param device destination device.
      * @return Error.
      */
@@ -6,14 +6,22 @@
 
 #include <blkid/blkid.h>
 #include <common/utils/retry.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <sys/mount.h>
+#include <unistd.h>
+#include <vector>
+
+#include <Poco/InflatingStream.h>
 
 #include <core/common/tools/logger.hpp>
 
 #include <common/utils/exception.hpp>
-#include <common/utils/exec.hpp>
 
 #include "partitionmanager.hpp"
 
@@ -31,6 +39,10 @@ constexpr auto cTagTypePartUUID = "PARTUUID";
 constexpr auto cUmountRetries   = 3;
 constexpr auto cUmountDelay     = Time::cSeconds;
 constexpr auto cUmountMaxDelay  = 5 * Time::cSeconds;
+constexpr auto cDirectIOAlign   = 4096;
+constexpr auto cInstallBufSize  = 1024 * 1024;
+constexpr auto cCopyBufSize     = 4 * 1024 * 1024;
+constexpr auto cCopyBlockSize   = 4096;
 
 /***********************************************************************************************************************
  * Static
@@ -57,6 +69,160 @@ std::string GetParentDevice(const std::string& block)
     return (std::filesystem::path("/dev") / p.parent_path().filename()).string();
 }
 
+RetWithError<int> OpenDevice(const std::string& device)
+{
+    // Bypass page cache: the image is written once and never read back by SM. Some targets (e.g. tmpfs files) don't
+    // support O_DIRECT, fall back to buffered IO for them.
+    if (auto fd = open(device.c_str(), O_WRONLY | O_DIRECT | O_CLOEXEC); fd >= 0) {
+        return fd;
+    }
+
+    if (errno != EINVAL) {
+        return {-1, Error(ErrorEnum::eFailed, strerror(errno))};
+    }
+
+    auto fd = open(device.c_str(), O_WRONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return {-1, Error(ErrorEnum::eFailed, strerror(errno))};
+    }
+
+    return fd;
+}
+
+Error DisableDirectIO(int fd)
+{
+    auto flags = fcntl(fd, F_GETFL);
+    if (flags < 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    if ((flags & O_DIRECT) && fcntl(fd, F_SETFL, flags & ~O_DIRECT) != 0) {
+        return Error(ErrorEnum::eFailed, strerror(errno));
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error WriteAll(int fd, const uint8_t* data, size_t size)
+{
+    while (size > 0) {
+        auto written = write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return Error(ErrorEnum::eFailed, strerror(errno));
+        }
+
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+RetWithError<size_t> GetDeviceSize(int fd)
+{
+    auto size = lseek(fd, 0, SEEK_END);
+    if (size < 0) {
+        return {0, Error(ErrorEnum::eFailed, strerror(errno))};
+    }
+
+    return static_cast<size_t>(size);
+}
+
+Error ReadAt(int fd, uint8_t* data, size_t size, off_t offset)
+{
+    while (size > 0) {
+        auto count = pread(fd, data, size, offset);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return Error(ErrorEnum::eFailed, strerror(errno));
+        }
+
+        if (count == 0) {
+            return Error(ErrorEnum::eFailed, "unexpected end of device");
+        }
+
+        data += count;
+        size -= static_cast<size_t>(count);
+        offset += count;
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error WriteAt(int fd, const uint8_t* data, size_t size, off_t offset)
+{
+    while (size > 0) {
+        auto count = pwrite(fd, data, size, offset);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return Error(ErrorEnum::eFailed, strerror(errno));
+        }
+
+        data += count;
+        size -= static_cast<size_t>(count);
+        offset += count;
+    }
+
+    return ErrorEnum::eNone;
+}
+
+// Writes the blocks of src chunk which differ from dst chunk, adjacent differing blocks are written at once.
+RetWithError<size_t> WriteChangedBlocks(int fd, const uint8_t* src, const uint8_t* dst, size_t size, off_t offset)
+{
+    size_t changed  = 0;
+    size_t runStart = 0;
+    size_t runSize  = 0;
+
+    auto flushRun = [&]() -> Error {
+        if (runSize == 0) {
+            return ErrorEnum::eNone;
+        }
+
+        if (auto err = WriteAt(fd, src + runStart, runSize, offset + static_cast<off_t>(runStart)); !err.IsNone()) {
+            return err;
+        }
+
+        changed += runSize;
+        runSize = 0;
+
+        return ErrorEnum::eNone;
+    };
+
+    for (size_t pos = 0; pos < size; pos += cCopyBlockSize) {
+        auto blockSize = std::min<size_t>(cCopyBlockSize, size - pos);
+
+        if (memcmp(src + pos, dst + pos, blockSize) != 0) {
+            if (runSize == 0) {
+                runStart = pos;
+            }
+
+            runSize += blockSize;
+
+            continue;
+        }
+
+        if (auto err = flushRun(); !err.IsNone()) {
+            return {changed, err};
+        }
+    }
+
+    if (auto err = flushRun(); !err.IsNone()) {
+        return {changed, err};
+    }
+
+    return changed;
+}
+
 } // namespace
 
 /***********************************************************************************************************************
@@ -153,19 +319,135 @@ Error PartitionManager::CopyDevice(const std::string& src, const std::string& ds
         return ErrorEnum::eNone;
     }
 
-    auto result = common::utils::ExecCommand({"dd", "if=" + src, "of=" + dst, "bs=1M"});
-    if (!result.mError.IsNone()) {
-        return AOS_ERROR_WRAP(result.mError);
+    LOG_DBG() << "Copy device" << Log::Field("src", src.c_str()) << Log::Field("dst", dst.c_str());
+
+    auto srcFd = open(src.c_str(), O_RDONLY | O_CLOEXEC);
+    if (srcFd < 0) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, strerror(errno)));
     }
 
+    [[maybe_unused]] auto closeSrc = DeferRelease(&srcFd, [](const int* fd) { close(*fd); });
+
+    auto dstFd = open(dst.c_str(), O_RDWR | O_CLOEXEC);
+    if (dstFd < 0) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, strerror(errno)));
+    }
+
+    [[maybe_unused]] auto closeDst = DeferRelease(&dstFd, [](const int* fd) { close(*fd); });
+
+    auto [srcSize, err] = GetDeviceSize(srcFd);
+    if (!err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    size_t dstSize = 0;
+
+    if (Tie(dstSize, err) = GetDeviceSize(dstFd); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (dstSize < srcSize) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "destination device is smaller than source"));
+    }
+
+    posix_fadvise(srcFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    posix_fadvise(dstFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    // A/B partitions usually differ in a small part only: compare both devices and write only changed blocks to save
+    // time and flash endurance.
+    std::vector<uint8_t> srcBuffer(cCopyBufSize), dstBuffer(cCopyBufSize);
+    size_t               changed = 0;
+
+    for (size_t offset = 0; offset < srcSize; offset += cCopyBufSize) {
+        auto size = std::min<size_t>(cCopyBufSize, srcSize - offset);
+
+        if (err = ReadAt(srcFd, srcBuffer.data(), size, static_cast<off_t>(offset)); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        if (err = ReadAt(dstFd, dstBuffer.data(), size, static_cast<off_t>(offset)); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        auto [chunkChanged, writeErr]
+            = WriteChangedBlocks(dstFd, srcBuffer.data(), dstBuffer.data(), size, static_cast<off_t>(offset));
+        if (!writeErr.IsNone()) {
+            return AOS_ERROR_WRAP(writeErr);
+        }
+
+        changed += chunkChanged;
+    }
+
+    if (changed != 0 && fsync(dstFd) != 0) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, strerror(errno)));
+    }
+
+    LOG_DBG() << "Device copied" << Log::Field("size", srcSize) << Log::Field("changed", changed);
+
     return ErrorEnum::eNone;
 }
 
 Error PartitionManager::InstallImage(const std::string& image, const std::string& device) const
 {
-    auto result = common::utils::ExecCommand({"dd", "if=" + image, "of=" + device, "bs=1M"});
-    if (!result.mError.IsNone()) {
-        return AOS_ERROR_WRAP(result.mError);
+    LOG_DBG() << "Install image" << Log::Field("image", image.c_str()) << Log::Field("device", device.c_str());
+
+    try {
+        std::ifstream file(image, std::ios::binary);
+        if (!file) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "can't open image"));
+        }
+
+        Poco::InflatingInputStream inflater(file, Poco::InflatingStreamBuf::STREAM_GZIP);
+
+        auto [fd, err] = OpenDevice(device);
+        if (!err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        [[maybe_unused]] auto closeFd = DeferRelease(&fd, [](const int* fd) { close(*fd); });
+
+        // O_DIRECT requires buffer address and write size aligned to the logical block size.
+        std::unique_ptr<uint8_t, decltype(&free)> buffer(
+            static_cast<uint8_t*>(aligned_alloc(cDirectIOAlign, cInstallBufSize)), free);
+        if (!buffer) {
+            return AOS_ERROR_WRAP(ErrorEnum::eNoMemory);
+        }
+
+        size_t total = 0;
+
+        while (inflater) {
+            inflater.read(reinterpret_cast<char*>(buffer.get()), cInstallBufSize);
+
+            auto size = static_cast<size_t>(inflater.gcount());
+            if (size == 0) {
+                break;
+            }
+
+            // Only the last chunk may be unaligned: write it through page cache.
+            if (size % cDirectIOAlign != 0) {
+                if (err = DisableDirectIO(fd); !err.IsNone()) {
+                    return AOS_ERROR_WRAP(err);
+                }
+            }
+
+            if (err = WriteAll(fd, buffer.get(), size); !err.IsNone()) {
+                return AOS_ERROR_WRAP(err);
+            }
+
+            total += size;
+        }
+
+        if (inflater.bad()) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "failed to decompress image"));
+        }
+
+        if (fsync(fd) != 0) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, strerror(errno)));
+        }
+
+        LOG_DBG() << "Image installed" << Log::Field("device", device.c_str()) << Log::Field("size", total);
+    } catch (const std::exception& e) {
+        return AOS_ERROR_WRAP(common::utils::ToAosError(e));
     }
 
     return ErrorEnum::eNone;
@@ -53,9 +53,9 @@ public:
     Error CopyDevice(const std::string& src, const std::string& dst) const override;
 
     /**
-     * Copies image to device.
+     * Decompresses gzip image to device.
      *
-     * @param image image path.
+     * @param image gzip compressed image path.
      * @param device destination device.
      * @return Error.
      */
@@ -9,6 +9,8 @@
 #include <future>
 #include <vector>
 
+#include <Poco/InflatingStream.h>
+#include <Poco/StreamCopier.h>
 #include <gtest/gtest.h>
 
 #include <core/common/tests/mocks/currentnodeinfoprovidermock.hpp>
@@ -52,7 +54,6 @@ const auto     cBootPartitionMountDir  = cBootRuntimeWorkingDir / "mnt";
 const auto     cTestDisk               = cTestDir / "disk";
 const auto     cPartition1             = cTestDisk / "1";
 const auto     cPartition2             = cTestDisk / "2";
-const auto     cUpdateImage            = cBootRuntimeWorkingDir / "images" / "boot.img";
 const auto     cUpdateImageArchivePath = cTestDir / "boot.img.gz";
 constexpr auto cRuntimeID              = "ddb944db-faba-39d9-9982-8be46f10293b";
 
@@ -561,11 +562,15 @@ TEST_F(BootRuntimeTest, StartInstance)
         return ErrorEnum::eNone;
     }));
     EXPECT_CALL(*mMockBootController, SetMainBoot(1)).WillOnce(Return(ErrorEnum::eNone));
-    EXPECT_CALL(*mPartitionManager, InstallImage(cUpdateImage.c_str(), mBootBPartition.mDevice))
+    EXPECT_CALL(*mPartitionManager, InstallImage(cUpdateImageArchivePath.string(), mBootBPartition.mDevice))
         .WillOnce(Invoke([](const std::string& from, const std::string& to) {
             LOG_DBG() << "Installing image from " << from.c_str() << " to " << to.c_str();
 
-            std::filesystem::copy_file(from, to + "/version.txt", std::filesystem::copy_options::overwrite_existing);
+            std::ifstream              archive(from, std::ios::binary);
+            std::ofstream              image(to + "/version.txt", std::ios::binary | std::ios::trunc);
+            Poco::InflatingInputStream inflater(archive, Poco::InflatingStreamBuf::STREAM_GZIP);
+
+            Poco::StreamCopier::copyStream(inflater, image);
 
             return ErrorEnum::eNone;
         }));
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include <Poco/DeflatingStream.h>
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <sm/launcher/runtimes/boot/partitionmanager.hpp>
+
+using namespace testing;
+
+namespace aos::sm::launcher {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+const auto cTestDir   = std::filesystem::absolute("testPartitionManager");
+const auto cImagePath = cTestDir / "boot.img.gz";
+const auto cDevice    = cTestDir / "device";
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+std::string CreateImage(size_t size)
+{
+    std::string content;
+
+    content.reserve(size);
+
+    for (size_t i = 0; i < size; i++) {
+        content.push_back(static_cast<char>(i % 251));
+    }
+
+    std::ofstream               file(cImagePath, std::ios::binary | std::ios::trunc);
+    Poco::DeflatingOutputStream deflater(file, Poco::DeflatingStreamBuf::STREAM_GZIP);
+
+    deflater.write(content.data(), content.size());
+    deflater.close();
+
+    return content;
+}
+
+std::string ReadDevice()
+{
+    std::ifstream file(cDevice, std::ios::binary);
+
+    return std::string(std::istreambuf_iterator<char>(file), {});
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class PartitionManagerTest : public Test {
+protected:
+    void SetUp() override
+    {
+        tests::utils::InitLog();
+
+        std::filesystem::remove_all(cTestDir);
+        std::filesystem::create_directories(cTestDir);
+
+        std::ofstream(cDevice).close();
+    }
+
+    void TearDown() override { std::filesystem::remove_all(cTestDir); }
+
+    PartitionManager mPartitionManager;
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(PartitionManagerTest, InstallImage)
+{
+    // Not a multiple of the buffer nor of the block size to cover the unaligned tail.
+    auto content = CreateImage(3 * 1024 * 1024 + 123);
+
+    ASSERT_TRUE(mPartitionManager.InstallImage(cImagePath.string(), cDevice.string()).IsNone());
+
+    EXPECT_EQ(ReadDevice(), content);
+}
+
+TEST_F(PartitionManagerTest, InstallCorruptedImage)
+{
+    std::ofstream(cImagePath) << "not a gzip image";
+
+    EXPECT_FALSE(mPartitionManager.InstallImage(cImagePath.string(), cDevice.string()).IsNone());
+}
+
+TEST_F(PartitionManagerTest, InstallMissingImage)
+{
+    EXPECT_TRUE(mPartitionManager.InstallImage((cTestDir / "missing.gz").string(), cDevice.string())
+                    .Is(ErrorEnum::eNotFound));
+}
+
+TEST_F(PartitionManagerTest, CopyDevice)
+{
+    const auto srcDevice = cTestDir / "src";
+
+    std::string srcContent(5 * 1024 * 1024 + 321, 'a');
+    std::string dstContent = srcContent + std::string(4096, 'z');
+
+    // Changed blocks: inside a chunk, across the chunk boundary and in the unaligned tail.
+    srcContent[10]                    = 'b';
+    srcContent[4 * 1024 * 1024 - 1]   = 'c';
+    srcContent[4 * 1024 * 1024]       = 'd';
+    srcContent[srcContent.size() - 1] = 'e';
+
+    std::ofstream(srcDevice, std::ios::binary) << srcContent;
+    std::ofstream(cDevice, std::ios::binary) << dstContent;
+
+    ASSERT_TRUE(mPartitionManager.CopyDevice(srcDevice.string(), cDevice.string()).IsNone());
+
+    EXPECT_EQ(ReadDevice(), srcContent + std::string(4096, 'z'));
+}
+
+TEST_F(PartitionManagerTest, CopyDeviceToSmallerDevice)
+{
+    const auto srcDevice = cTestDir / "src";
+
+    std::ofstream(srcDevice, std::ios::binary) << std::string(8192, 'a');
+    std::ofstream(cDevice, std::ios::binary) << std::string(4096, 'b');
+
+    EXPECT_TRUE(mPartitionManager.CopyDevice(srcDevice.string(), cDevice.string()).Is(ErrorEnum::eInvalidArgument));
+    EXPECT_EQ(ReadDevice(), std::string(4096, 'b'));
+}
+
+} // namespace aos::sm::launcher
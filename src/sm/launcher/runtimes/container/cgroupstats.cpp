@@ -0,0 +1,485 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <string_view>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <core/common/tools/logger.hpp>
+
+#include <common/utils/filesystem.hpp>
+
+#include "cgroupstats.hpp"
+
+namespace aos::sm::launcher {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+std::string_view NextLine(std::string_view& content)
+{
+    auto pos  = content.find('\n');
+    auto line = content.substr(0, pos);
+
+    content.remove_prefix(pos == std::string_view::npos ? content.size() : pos + 1);
+
+    return line;
+}
+
+std::string_view NextField(std::string_view& line)
+{
+    while (!line.empty() && line.front() == ' ') {
+        line.remove_prefix(1);
+    }
+
+    auto pos   = line.find(' ');
+    auto field = line.substr(0, pos);
+
+    line.remove_prefix(pos == std::string_view::npos ? line.size() : pos);
+
+    return field;
+}
+
+bool ParseUint(std::string_view str, uint64_t& value)
+{
+    if (str.empty()) {
+        return false;
+    }
+
+    value = 0;
+
+    for (auto c : str) {
+        if (!IsDigit(c)) {
+            return false;
+        }
+
+        value = value * 10 + static_cast<uint64_t>(c - '0');
+    }
+
+    return true;
+}
+
+// Parses PSI averages which are printed with two fractional digits.
+bool ParseDecimal(std::string_view str, double& value)
+{
+    auto     pos = str.find('.');
+    uint64_t intPart {};
+
+    if (!ParseUint(str.substr(0, pos), intPart)) {
+        return false;
+    }
+
+    value = static_cast<double>(intPart);
+
+    if (pos == std::string_view::npos) {
+        return true;
+    }
+
+    double scale = 0.1;
+
+    for (auto c : str.substr(pos + 1)) {
+        if (!IsDigit(c)) {
+            return false;
+        }
+
+        value += (c - '0') * scale;
+        scale /= 10;
+    }
+
+    return true;
+}
+
+// Splits "key=value" field.
+bool SplitKeyValue(std::string_view field, std::string_view& key, std::string_view& value)
+{
+    auto pos = field.find('=');
+    if (pos == std::string_view::npos) {
+        return false;
+    }
+
+    key   = field.substr(0, pos);
+    value = field.substr(pos + 1);
+
+    return true;
+}
+
+Error ParseCPUStat(std::string_view content, uint64_t& usageUSec)
+{
+    while (!content.empty()) {
+        auto line = NextLine(content);
+
+        if (NextField(line) == "usage_usec") {
+            if (!ParseUint(NextField(line), usageUSec)) {
+                return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "can't parse cpu usage"));
+            }
+
+            return ErrorEnum::eNone;
+        }
+    }
+
+    return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "can't find cpu usage"));
+}
+
+Error ParseMemoryCurrent(std::string_view content, uint64_t& memoryCurrent)
+{
+    if (!ParseUint(NextLine(content), memoryCurrent)) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "can't parse memory usage"));
+    }
+
+    return ErrorEnum::eNone;
+}
+
+// Format: "some avg10=0.00 avg60=0.00 avg300=0.00 total=0", the same for "full" line.
+Error ParsePressure(std::string_view content, PressureStats& pressure)
+{
+    while (!content.empty()) {
+        auto line = NextLine(content);
+        auto kind = NextField(line);
+
+        if (kind != "some" && kind != "full") {
+            continue;
+        }
+
+        auto& avg10 = kind == "some" ? pressure.mSomeAvg10 : pressure.mFullAvg10;
+        auto& total = kind == "some" ? pressure.mSomeTotal : pressure.mFullTotal;
+
+        for (auto field = NextField(line); !field.empty(); field = NextField(line)) {
+            std::string_view key, value;
+
+            if (!SplitKeyValue(field, key, value)) {
+                continue;
+            }
+
+            if ((key == "avg10" && !ParseDecimal(value, avg10)) || (key == "total" && !ParseUint(value, total))) {
+                return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "can't parse pressure"));
+            }
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+// Format: "<major>:<minor> rbytes=0 wbytes=0 rios=0 wios=0 dbytes=0 dios=0" per device.
+Error ParseIOStat(std::string_view content, uint64_t& readBytes, uint64_t& writeBytes)
+{
+    readBytes  = 0;
+    writeBytes = 0;
+
+    while (!content.empty()) {
+        auto line = NextLine(content);
+
+        NextField(line);
+
+        for (auto field = NextField(line); !field.empty(); field = NextField(line)) {
+            std::string_view key, value;
+            uint64_t         bytes {};
+
+            if (!SplitKeyValue(field, key, value) || (key != "rbytes" && key != "wbytes")) {
+                continue;
+            }
+
+            if (!ParseUint(value, bytes)) {
+                return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "can't parse io stat"));
+            }
+
+            (key == "rbytes" ? readBytes : writeBytes) += bytes;
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+RetWithError<std::string_view> ReadStatFile(int fd, char* buffer)
+{
+    ssize_t size {};
+
+    do {
+        size = pread(fd, buffer, CgroupStatsCollector::cReadBufferSize, 0);
+    } while (size < 0 && errno == EINTR);
+
+    if (size < 0) {
+        return {{}, AOS_ERROR_WRAP(Error(errno, "can't read cgroup file"))};
+    }
+
+    std::string_view content(buffer, static_cast<size_t>(size));
+
+    // Drop truncated last line if the file doesn't fit the buffer.
+    if (content.size() == CgroupStatsCollector::cReadBufferSize) {
+        content = content.substr(0, content.rfind('\n') + 1);
+    }
+
+    return content;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+CgroupStatsCollector::~CgroupStatsCollector()
+{
+    for (auto& cgroup : mCgroups) {
+        CloseCgroup(cgroup);
+    }
+}
+
+Error CgroupStatsCollector::Init(const std::string& cgroupsPath, size_t numWorkers)
+{
+    LOG_DBG() << "Init cgroup stats collector" << Log::Field("cgroupsPath", cgroupsPath.c_str())
+              << Log::Field("numWorkers", numWorkers);
+
+    std::lock_guard lock {mMutex};
+
+    mCgroupsPath = cgroupsPath;
+    mNumWorkers  = std::max<size_t>(numWorkers, 1);
+
+    return ErrorEnum::eNone;
+}
+
+Error CgroupStatsCollector::AddCgroup(const std::string& name)
+{
+    std::lock_guard lock {mMutex};
+
+    if (std::any_of(mCgroups.begin(), mCgroups.end(), [&name](const Cgroup& cgroup) { return cgroup.mName == name; })) {
+        return ErrorEnum::eNone;
+    }
+
+    Cgroup cgroup;
+
+    cgroup.mName = name;
+    cgroup.mFDs.fill(cNotOpenedFD);
+
+    mCgroups.push_back(std::move(cgroup));
+
+    return ErrorEnum::eNone;
+}
+
+Error CgroupStatsCollector::RemoveCgroup(const std::string& name)
+{
+    std::lock_guard lock {mMutex};
+
+    auto it = std::find_if(
+        mCgroups.begin(), mCgroups.end(), [&name](const Cgroup& cgroup) { return cgroup.mName == name; });
+    if (it == mCgroups.end()) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "cgroup not found"));
+    }
+
+    CloseCgroup(*it);
+
+    mCgroups.erase(it);
+
+    return ErrorEnum::eNone;
+}
+
+Error CgroupStatsCollector::Collect()
+{
+    std::lock_guard lock {mMutex};
+
+    return CollectLocked();
+}
+
+RetWithError<std::shared_ptr<const CgroupStatsSnapshot>> CgroupStatsCollector::GetSnapshot(uint64_t minGeneration)
+{
+    if (auto snapshot = GetSnapshot(); snapshot->mGeneration >= minGeneration) {
+        return snapshot;
+    }
+
+    std::lock_guard lock {mMutex};
+
+    // Snapshot could be collected by other caller while waiting for the lock.
+    if (auto snapshot = GetSnapshot(); snapshot->mGeneration >= minGeneration) {
+        return snapshot;
+    }
+
+    if (auto err = CollectLocked(); !err.IsNone()) {
+        return {nullptr, err};
+    }
+
+    return GetSnapshot();
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+void CgroupStatsCollector::CloseCgroup(Cgroup& cgroup)
+{
+    for (auto& fd : cgroup.mFDs) {
+        if (fd >= 0) {
+            close(fd);
+        }
+
+        fd = cNotOpenedFD;
+    }
+
+    if (cgroup.mDirFD >= 0) {
+        close(cgroup.mDirFD);
+    }
+
+    cgroup.mDirFD = cNotOpenedFD;
+}
+
+Error CgroupStatsCollector::OpenCgroup(const std::string& cgroupsPath, Cgroup& cgroup)
+{
+    const auto path = common::utils::JoinPath(cgroupsPath, cgroup.mName);
+
+    cgroup.mDirFD = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (cgroup.mDirFD < 0) {
+        return AOS_ERROR_WRAP(Error(errno, "can't open cgroup"));
+    }
+
+    for (size_t i = 0; i < eNumStatFiles; i++) {
+        cgroup.mFDs[i] = openat(cgroup.mDirFD, cStatFiles[i], O_RDONLY | O_CLOEXEC);
+        if (cgroup.mFDs[i] >= 0) {
+            continue;
+        }
+
+        // PSI and IO controller files are optional and depend on kernel config and enabled controllers.
+        if (i != eCPUStat && i != eMemoryCurrent) {
+            cgroup.mFDs[i] = cUnsupportedFD;
+
+            continue;
+        }
+
+        auto err = Error(errno, "can't open cgroup stat file");
+
+        CloseCgroup(cgroup);
+
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error CgroupStatsCollector::ReadCgroup(const Cgroup& cgroup, char* buffer, CgroupStats& stats)
+{
+    stats.mTimestamp = Time::Now();
+
+    for (size_t i = 0; i < eNumStatFiles; i++) {
+        if (cgroup.mFDs[i] < 0) {
+            continue;
+        }
+
+        auto [content, err] = ReadStatFile(cgroup.mFDs[i], buffer);
+        if (!err.IsNone()) {
+            return err;
+        }
+
+        switch (i) {
+        case eCPUStat:
+            err = ParseCPUStat(content, stats.mCPUUsageUSec);
+            break;
+
+        case eMemoryCurrent:
+            err = ParseMemoryCurrent(content, stats.mMemoryCurrent);
+            break;
+
+        case eCPUPressure:
+            err = ParsePressure(content, stats.mCPUPressure);
+            break;
+
+        case eMemoryPressure:
+            err = ParsePressure(content, stats.mMemoryPressure);
+            break;
+
+        case eIOPressure:
+            err = ParsePressure(content, stats.mIOPressure);
+            break;
+
+        case eIOStat:
+            err = ParseIOStat(content, stats.mIOReadBytes, stats.mIOWriteBytes);
+            break;
+
+        default:
+            break;
+        }
+
+        if (!err.IsNone()) {
+            return err;
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error CgroupStatsCollector::CollectLocked()
+{
+    std::vector<Result> results(mCgroups.size());
+
+    const auto numWorkers = std::min(mNumWorkers, mCgroups.size());
+
+    if (numWorkers <= 1) {
+        CollectRange(0, mCgroups.size(), results);
+    } else {
+        const auto               chunkSize = (mCgroups.size() + numWorkers - 1) / numWorkers;
+        std::vector<std::thread> workers;
+
+        for (size_t begin = chunkSize; begin < mCgroups.size(); begin += chunkSize) {
+            workers.emplace_back(&CgroupStatsCollector::CollectRange, this, begin,
+                std::min(begin + chunkSize, mCgroups.size()), std::ref(results));
+        }
+
+        CollectRange(0, chunkSize, results);
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    auto snapshot = std::make_shared<CgroupStatsSnapshot>();
+
+    snapshot->mGeneration = GetSnapshot()->mGeneration + 1;
+    snapshot->mStats.reserve(mCgroups.size());
+
+    for (size_t i = 0; i < mCgroups.size(); i++) {
+        if (results[i].mValid) {
+            snapshot->mStats.emplace(mCgroups[i].mName, results[i].mStats);
+        }
+    }
+
+    std::atomic_store(&mSnapshot, std::shared_ptr<const CgroupStatsSnapshot>(std::move(snapshot)));
+
+    return ErrorEnum::eNone;
+}
+
+void CgroupStatsCollector::CollectRange(size_t begin, size_t end, std::vector<Result>& results)
+{
+    char buffer[cReadBufferSize];
+
+    for (auto i = begin; i < end; i++) {
+        auto& cgroup = mCgroups[i];
+
+        // Cgroup is created when instance is started, so it is opened on first collect after that.
+        if (cgroup.mDirFD < 0 && !OpenCgroup(mCgroupsPath, cgroup).IsNone()) {
+            continue;
+        }
+
+        if (auto err = ReadCgroup(cgroup, buffer, results[i].mStats); !err.IsNone()) {
+            LOG_WRN() << "Can't read cgroup stats" << Log::Field("cgroup", cgroup.mName.c_str()) << Log::Field(err);
+
+            // Cgroup is recreated on instance restart, reopen it on next collect.
+            CloseCgroup(cgroup);
+
+            continue;
+        }
+
+        results[i].mValid = true;
+    }
+}
+
+} // namespace aos::sm::launcher
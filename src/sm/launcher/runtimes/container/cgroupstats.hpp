@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_SM_LAUNCHER_RUNTIMES_CONTAINER_CGROUPSTATS_HPP_
+#define AOS_SM_LAUNCHER_RUNTIMES_CONTAINER_CGROUPSTATS_HPP_
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <core/common/tools/error.hpp>
+#include <core/common/tools/time.hpp>
+
+namespace aos::sm::launcher {
+
+/**
+ * Cgroup PSI pressure stats.
+ */
+struct PressureStats {
+    double   mSomeAvg10 {};
+    uint64_t mSomeTotal {};
+    double   mFullAvg10 {};
+    uint64_t mFullTotal {};
+};
+
+/**
+ * Cgroup stats.
+ */
+struct CgroupStats {
+    Time          mTimestamp;
+    uint64_t      mCPUUsageUSec {};
+    uint64_t      mMemoryCurrent {};
+    uint64_t      mIOReadBytes {};
+    uint64_t      mIOWriteBytes {};
+    PressureStats mCPUPressure;
+    PressureStats mMemoryPressure;
+    PressureStats mIOPressure;
+};
+
+/**
+ * Stats of all collected cgroups.
+ */
+struct CgroupStatsSnapshot {
+    uint64_t                                     mGeneration {};
+    std::unordered_map<std::string, CgroupStats> mStats;
+};
+
+/**
+ * Collects stats of all added cgroups in one pass and publishes them as immutable snapshot.
+ *
+ * Cgroup files are kept open and read with pread into fixed buffers. Readers get the latest snapshot without locking.
+ */
+class CgroupStatsCollector {
+public:
+    static constexpr size_t cReadBufferSize = 4096;
+
+    /**
+     * Destructor.
+     */
+    ~CgroupStatsCollector();
+
+    /**
+     * Initializes collector.
+     *
+     * @param cgroupsPath path to parent cgroup of collected cgroups.
+     * @param numWorkers number of threads used to collect stats.
+     * @return Error.
+     */
+    Error Init(const std::string& cgroupsPath, size_t numWorkers = 1);
+
+    /**
+     * Adds cgroup to collect. The cgroup is not required to exist yet.
+     *
+     * @param name cgroup name.
+     * @return Error.
+     */
+    Error AddCgroup(const std::string& name);
+
+    /**
+     * Removes cgroup.
+     *
+     * @param name cgroup name.
+     * @return Error.
+     */
+    Error RemoveCgroup(const std::string& name);
+
+    /**
+     * Collects stats of all cgroups and publishes new snapshot. Cgroups that don't exist are skipped.
+     *
+     * @return Error.
+     */
+    Error Collect();
+
+    /**
+     * Returns snapshot with generation not less than requested one, collects new snapshot if needed.
+     *
+     * @param minGeneration min snapshot generation.
+     * @return RetWithError<std::shared_ptr<const CgroupStatsSnapshot>>.
+     */
+    RetWithError<std::shared_ptr<const CgroupStatsSnapshot>> GetSnapshot(uint64_t minGeneration);
+
+    /**
+     * Returns latest snapshot.
+     *
+     * @return std::shared_ptr<const CgroupStatsSnapshot>.
+     */
+    std::shared_ptr<const CgroupStatsSnapshot> GetSnapshot() const { return std::atomic_load(&mSnapshot); }
+
+private:
+    enum StatFile { eCPUStat, eMemoryCurrent, eCPUPressure, eMemoryPressure, eIOPressure, eIOStat, eNumStatFiles };
+
+    static constexpr int                                    cNotOpenedFD   = -1;
+    static constexpr int                                    cUnsupportedFD = -2;
+    static constexpr std::array<const char*, eNumStatFiles> cStatFiles
+        = {"cpu.stat", "memory.current", "cpu.pressure", "memory.pressure", "io.pressure", "io.stat"};
+
+    struct Cgroup {
+        std::string                    mName;
+        int                            mDirFD = cNotOpenedFD;
+        std::array<int, eNumStatFiles> mFDs {};
+    };
+
+    struct Result {
+        bool        mValid {};
+        CgroupStats mStats;
+    };
+
+    static void  CloseCgroup(Cgroup& cgroup);
+    static Error OpenCgroup(const std::string& cgroupsPath, Cgroup& cgroup);
+    static Error ReadCgroup(const Cgroup& cgroup, char* buffer, CgroupStats& stats);
+    Error        CollectLocked();
+    void         CollectRange(size_t begin, size_t end, std::vector<Result>& results);
+
+    std::mutex                                 mMutex;
+    std::string                                mCgroupsPath;
+    size_t                                     mNumWorkers = 1;
+    std::vector<Cgroup>                        mCgroups;
+    std::shared_ptr<const CgroupStatsSnapshot> mSnapshot {std::make_shared<CgroupStatsSnapshot>()};
+};
+
+} // namespace aos::sm::launcher
+
+#endif
@@ -242,13 +242,16 @@ Error ContainerRuntime::StartInstance(const InstanceInfo& instanceInfo, Instance
         }
 
         if (instance) {
-            if (auto err = instance->Stop(); !err.IsNone()) {
+            // Parsed configs are kept for restart and reloaded by the instance only if the manifest digest changes.
+            if (auto err = instance->Stop(true); !err.IsNone()) {
                 LOG_ERR() << "Failed to stop instance"
                           << Log::Field("instance", static_cast<const InstanceIdent&>(instanceInfo)) << Log::Field(err);
             }
 
             instance->GetStatus(status);
             SendInstanceStatus(status);
+
+            instance->UpdateInstanceInfo(instanceInfo);
         } else {
             std::lock_guard lock {mMutex};
 
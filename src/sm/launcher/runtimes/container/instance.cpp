@@ -12,6 +12,7 @@
 
 #include <common/utils/exception.hpp>
 #include <common/utils/filesystem.hpp>
+#include <common/utils/tracer.hpp>
 #include <common/utils/utils.hpp>
 
 #include "instance.hpp"
@@ -85,6 +86,8 @@ Instance::Instance(const std::string& instanceID, const ContainerConfig& config,
 
 Error Instance::Start()
 {
+    AOS_TRACE_FUNCTION("instance");
+
     std::lock_guard lock {mMutex};
 
     Error err;
@@ -96,18 +99,15 @@ Error Instance::Start()
         }
     });
 
-    auto imageConfig = std::make_unique<oci::ImageConfig>();
-    auto itemConfig  = std::make_unique<oci::ItemConfig>();
-
-    if (err = LoadConfigs(*imageConfig, *itemConfig); !err.IsNone()) {
+    if (err = LoadConfigs(); !err.IsNone()) {
         return err;
     }
 
-    if (err = PrepareRuntimeDir(*imageConfig, *itemConfig); !err.IsNone()) {
+    if (err = PrepareRuntimeDir(*mImageConfig, *mItemConfig); !err.IsNone()) {
         return err;
     }
 
-    mRunStatus = mRunner.StartInstance(mInstanceID, itemConfig->mRunParameters);
+    mRunStatus = mRunner.StartInstance(mInstanceID, mItemConfig->mRunParameters);
     err        = mRunStatus.mError;
 
     if (mRunStatus.mState != InstanceStateEnum::eActive) {
@@ -136,14 +136,11 @@ Error Instance::Activate()
         }
     });
 
-    auto imageConfig = std::make_unique<oci::ImageConfig>();
-    auto itemConfig  = std::make_unique<oci::ItemConfig>();
-
-    if (err = LoadConfigs(*imageConfig, *itemConfig); !err.IsNone()) {
+    if (err = LoadConfigs(); !err.IsNone()) {
         return err;
     }
 
-    mRunStatus = mRunner.WatchInstance(mInstanceID, itemConfig->mRunParameters);
+    mRunStatus = mRunner.WatchInstance(mInstanceID, mItemConfig->mRunParameters);
     err        = mRunStatus.mError;
 
     if (mRunStatus.mState != InstanceStateEnum::eActive) {
@@ -159,8 +156,10 @@ Error Instance::Activate()
     return ErrorEnum::eNone;
 }
 
-Error Instance::Stop()
+Error Instance::Stop(bool keepConfigs)
 {
+    AOS_TRACE_FUNCTION("instance");
+
     std::lock_guard lock {mMutex};
 
     Error stopErr;
@@ -201,9 +200,21 @@ Error Instance::Stop()
         stopErr = AOS_ERROR_WRAP(err);
     }
 
+    if (!keepConfigs) {
+        mImageConfig.reset();
+        mItemConfig.reset();
+    }
+
     return stopErr;
 }
 
+void Instance::UpdateInstanceInfo(const InstanceInfo& instanceInfo)
+{
+    std::lock_guard lock {mMutex};
+
+    mInstanceInfo = instanceInfo;
+}
+
 void Instance::GetStatus(InstanceStatus& status) const
 {
     std::lock_guard lock {mMutex};
@@ -235,8 +246,16 @@ bool Instance::UpdateRunStatus(const RunStatus& runStatus)
  * Private
  **********************************************************************************************************************/
 
-Error Instance::LoadConfigs(oci::ImageConfig& imageConfig, oci::ItemConfig& itemConfig)
+Error Instance::LoadConfigs()
 {
+    // Parsed configs are kept between restarts of the instance and reloaded only if the manifest digest changes.
+    if (mImageConfig && mItemConfig && mConfigsDigest == mInstanceInfo.mManifestDigest) {
+        return ErrorEnum::eNone;
+    }
+
+    mImageConfig.reset();
+    mItemConfig.reset();
+
     auto path = std::make_unique<StaticString<cFilePathLen>>();
 
     if (auto err = mItemInfoProvider.GetBlobPath(mInstanceInfo.mManifestDigest, *path); !err.IsNone()) {
@@ -253,7 +272,10 @@ Error Instance::LoadConfigs(oci::ImageConfig& imageConfig, oci::ItemConfig& item
         return AOS_ERROR_WRAP(err);
     }
 
-    if (auto err = mOCISpec.LoadImageConfig(*path, imageConfig); !err.IsNone()) {
+    auto imageConfig = std::make_unique<oci::ImageConfig>();
+    auto itemConfig  = std::make_unique<oci::ItemConfig>();
+
+    if (auto err = mOCISpec.LoadImageConfig(*path, *imageConfig); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
@@ -262,11 +284,15 @@ Error Instance::LoadConfigs(oci::ImageConfig& imageConfig, oci::ItemConfig& item
             return AOS_ERROR_WRAP(err);
         }
 
-        if (auto err = mOCISpec.LoadItemConfig(*path, itemConfig); !err.IsNone()) {
+        if (auto err = mOCISpec.LoadItemConfig(*path, *itemConfig); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
         }
     }
 
+    mImageConfig   = std::move(imageConfig);
+    mItemConfig    = std::move(itemConfig);
+    mConfigsDigest = mInstanceInfo.mManifestDigest;
+
     return ErrorEnum::eNone;
 }
 
@@ -710,6 +736,8 @@ Error Instance::PrepareStateStorage()
 Error Instance::PrepareRootFS(
     const std::string& runtimeDir, const oci::ImageConfig& imageConfig, const oci::RuntimeConfig& runtimeConfig)
 {
+    AOS_TRACE_FUNCTION("instance");
+
     LOG_DBG() << "Prepare rootfs" << Log::Field("instanceID", mInstanceID.c_str());
 
     auto mountPoints
@@ -747,6 +775,8 @@ Error Instance::PrepareRootFS(
 
 Error Instance::PrepareNetwork(const std::string& runtimeDir)
 {
+    AOS_TRACE_FUNCTION("network");
+
     LOG_DBG() << "Prepare network" << Log::Field("instanceID", mInstanceID.c_str());
 
     if (auto err = mFileSystem.PrepareNetworkDir(common::utils::JoinPath(runtimeDir, cMountPointsDir)); !err.IsNone()) {
@@ -812,6 +842,8 @@ Error Instance::WriteHosts(const std::string& path, const Array<Host>& hosts) co
 
 Error Instance::PrepareRuntimeDir(const oci::ImageConfig& imageConfig, const oci::ItemConfig& itemConfig)
 {
+    AOS_TRACE_FUNCTION("instance");
+
     auto runtimeDir = common::utils::JoinPath(mConfig.mRuntimeDir, mInstanceID);
 
     if (auto err = mFileSystem.ClearDir(runtimeDir); !err.IsNone()) {
@@ -7,6 +7,7 @@
 #ifndef AOS_SM_LAUNCHER_RUNTIMES_CONTAINER_INSTANCE_HPP_
 #define AOS_SM_LAUNCHER_RUNTIMES_CONTAINER_INSTANCE_HPP_
 
+#include <memory>
 #include <mutex>
 
 #include <core/common/iamclient/itf/permhandler.hpp>
@@ -92,9 +93,17 @@ public:
     /**
      * Stops instance.
      *
+     * @param keepConfigs keep parsed image and item configs for the following start.
      * @return Error
      */
-    Error Stop();
+    Error Stop(bool keepConfigs = false);
+
+    /**
+     * Updates instance info of not running instance.
+     *
+     * @param instanceInfo instance info.
+     */
+    void UpdateInstanceInfo(const InstanceInfo& instanceInfo);
 
     /**
      * Returns instance ID.
@@ -157,7 +166,7 @@ private:
     static constexpr auto cStatePartitionName   = "states";
     static constexpr auto cStoragePartitionName = "storages";
 
-    Error  LoadConfigs(oci::ImageConfig& imageConfig, oci::ItemConfig& itemConfig);
+    Error  LoadConfigs();
     Error  CreateRuntimeConfig(const std::string& runtimeDir, const oci::ImageConfig& imageConfig,
          const oci::ItemConfig& itemConfig, oci::RuntimeConfig& runtimeConfig);
     Error  BindHostDirs(oci::RuntimeConfig& runtimeConfig);
@@ -184,6 +193,10 @@ private:
     RunStatus         mRunStatus;
     EnvVarStatusArray mEnvVarsStatuses;
 
+    std::unique_ptr<oci::ImageConfig> mImageConfig;
+    std::unique_ptr<oci::ItemConfig>  mItemConfig;
+    StaticString<oci::cDigestLen>     mConfigsDigest;
+
     const ContainerConfig&                    mConfig;
     const NodeInfo&                           mNodeInfo;
     FileSystemItf&                            mFileSystem;
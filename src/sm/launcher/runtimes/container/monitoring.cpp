@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <fstream>
+#include <sstream>
 #include <thread>
 
 #include <core/common/tools/logger.hpp>
@@ -33,6 +33,10 @@ Error Monitoring::Init(const NodeInfo& nodeInfo, networkmanager::InstanceTraffic
     mNodeInfo        = nodeInfo;
     mTrafficProvider = &trafficProvider;
 
+    if (auto err = mCgroupStats.Init(common::utils::JoinPath(cCgroupFSRoot, cCgroupsPath)); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
     return ErrorEnum::eNone;
 }
 
@@ -44,7 +48,14 @@ Error Monitoring::StartInstanceMonitoring(
     try {
         LOG_DBG() << "Start instance monitoring" << Log::Field("instanceID", instanceID.c_str());
 
-        mInstanceMonitoringCache.insert_or_assign(instanceID, MonitoringData {{}, partInfos, uid});
+        if (auto err = mCgroupStats.AddCgroup(instanceID); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        // Snapshots collected before the cgroup is added don't contain it: mark the current one as consumed to
+        // collect a new one on the first request.
+        mInstanceMonitoringCache.insert_or_assign(
+            instanceID, MonitoringData {{}, partInfos, uid, mCgroupStats.GetSnapshot()->mGeneration});
 
         return ErrorEnum::eNone;
     } catch (const std::exception& e) {
@@ -61,6 +72,10 @@ Error Monitoring::StopInstanceMonitoring(const std::string& instanceID)
 
         mInstanceMonitoringCache.erase(instanceID);
 
+        if (auto err = mCgroupStats.RemoveCgroup(instanceID); !err.IsNone() && !err.Is(ErrorEnum::eNotFound)) {
+            return AOS_ERROR_WRAP(err);
+        }
+
         return ErrorEnum::eNone;
     } catch (const std::exception& e) {
         return AOS_ERROR_WRAP(common::utils::ToAosError(e, ErrorEnum::eRuntime));
@@ -70,93 +85,107 @@ Error Monitoring::StopInstanceMonitoring(const std::string& instanceID)
 Error Monitoring::GetInstanceMonitoringData(
     const std::string& instanceID, monitoring::InstanceMonitoringData& monitoringData)
 {
-    std::lock_guard lock {mMutex};
+    std::vector<PartitionInfo> partInfos;
+    uid_t                      uid {};
+    uint64_t                   generation {};
 
-    try {
-        monitoringData.mMonitoringData.mTimestamp = Time::Now();
-        monitoringData.mMonitoringData.mCPU       = GetInstanceCPUUsage(instanceID);
-        monitoringData.mMonitoringData.mRAM       = GetInstanceRAMUsage(instanceID);
+    {
+        std::lock_guard lock {mMutex};
+
+        auto it = mInstanceMonitoringCache.find(instanceID);
+        if (it == mInstanceMonitoringCache.end()) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "instance is not monitored"));
+        }
 
-        LOG_DBG() << "Get instance monitoring data" << Log::Field("instanceID", instanceID.c_str())
-                  << Log::Field("cpu", monitoringData.mMonitoringData.mCPU)
-                  << Log::Field("ram", monitoringData.mMonitoringData.mRAM / cKilobyte);
+        partInfos  = it->second.mPartInfos;
+        uid        = it->second.mUID;
+        generation = it->second.mGeneration;
+    }
+
+    // All instances are collected in one pass: a new snapshot is collected when the instance has already consumed
+    // the current one, i.e. on the first request of the next monitoring period.
+    auto [snapshot, err] = mCgroupStats.GetSnapshot(generation + 1);
+    if (!err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
 
-        const auto& cachedData = mInstanceMonitoringCache.at(instanceID);
+    auto stats = snapshot->mStats.find(instanceID);
 
-        for (const auto& partition : cachedData.mPartInfos) {
-            auto err = monitoringData.mMonitoringData.mPartitions.EmplaceBack();
-            if (!err.IsNone()) {
+    {
+        std::lock_guard lock {mMutex};
+
+        auto it = mInstanceMonitoringCache.find(instanceID);
+        if (it == mInstanceMonitoringCache.end()) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "instance is not monitored"));
+        }
+
+        // Mark snapshot as consumed even if the instance cgroup is missing to not collect on each request.
+        it->second.mGeneration = snapshot->mGeneration;
+
+        if (stats == snapshot->mStats.end()) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "can't find instance cgroup stats"));
+        }
+
+        monitoringData.mMonitoringData.mCPU = GetInstanceCPUUsage(it->second.mCPUUsage, stats->second);
+    }
+
+    monitoringData.mMonitoringData.mTimestamp = stats->second.mTimestamp;
+    monitoringData.mMonitoringData.mRAM       = stats->second.mMemoryCurrent;
+
+    LOG_DBG() << "Get instance monitoring data" << Log::Field("instanceID", instanceID.c_str())
+              << Log::Field("cpu", monitoringData.mMonitoringData.mCPU)
+              << Log::Field("ram", monitoringData.mMonitoringData.mRAM / cKilobyte)
+              << Log::Field("cpuPressure", stats->second.mCPUPressure.mSomeAvg10)
+              << Log::Field("memoryPressure", stats->second.mMemoryPressure.mSomeAvg10)
+              << Log::Field("ioPressure", stats->second.mIOPressure.mSomeAvg10)
+              << Log::Field("ioRead", stats->second.mIOReadBytes / cKilobyte)
+              << Log::Field("ioWrite", stats->second.mIOWriteBytes / cKilobyte);
+
+    try {
+        for (const auto& partition : partInfos) {
+            if (err = monitoringData.mMonitoringData.mPartitions.EmplaceBack(); !err.IsNone()) {
                 return AOS_ERROR_WRAP(err);
             }
 
             auto& partitionUsage = monitoringData.mMonitoringData.mPartitions.Back();
 
             partitionUsage.mName     = partition.mName;
-            partitionUsage.mUsedSize = GetInstanceDiskUsage(partition.mPath.CStr(), cachedData.mUID);
+            partitionUsage.mUsedSize = GetInstanceDiskUsage(partition.mPath.CStr(), uid);
 
             LOG_DBG() << "Get instance monitoring data" << Log::Field("instanceID", instanceID.c_str())
                       << Log::Field("partition", partition.mName)
                       << Log::Field("usedSize", partitionUsage.mUsedSize / cKilobyte);
         }
-
-        if (auto err = mTrafficProvider->GetInstanceTraffic(
-                instanceID.c_str(), monitoringData.mMonitoringData.mDownload, monitoringData.mMonitoringData.mUpload);
-            !err.IsNone()) {
-            return AOS_ERROR_WRAP(err);
-        }
-
-        LOG_DBG() << "Get instance monitoring data" << Log::Field("instanceID", instanceID.c_str())
-                  << Log::Field("download", monitoringData.mMonitoringData.mDownload / cKilobyte)
-                  << Log::Field("upload", monitoringData.mMonitoringData.mUpload / cKilobyte);
-
-        return ErrorEnum::eNone;
     } catch (const std::exception& e) {
         return AOS_ERROR_WRAP(common::utils::ToAosError(e, ErrorEnum::eRuntime));
     }
-}
-
-/***********************************************************************************************************************
- * Private
- **********************************************************************************************************************/
 
-size_t Monitoring::GetInstanceCPUUSec(const std::string& instanceID)
-{
-    const auto cpuUsageFile = common::utils::JoinPath(cCgroupFSRoot, cCgroupsPath, instanceID, cCpuUsageFile);
-
-    std::ifstream file(cpuUsageFile);
-    if (!file.is_open()) {
-        AOS_ERROR_THROW(ErrorEnum::eNotFound, "can't find cpu usage file");
+    if (err = mTrafficProvider->GetInstanceTraffic(
+            instanceID.c_str(), monitoringData.mMonitoringData.mDownload, monitoringData.mMonitoringData.mUpload);
+        !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
 
-    std::string line;
-
-    while (getline(file, line)) {
-        std::istringstream lineStream(line);
-
-        std::string key;
-        size_t      value = 0;
-
-        if (lineStream >> key >> value) {
-            if (key == "usage_usec") {
-                return value;
-            }
-        }
-    }
+    LOG_DBG() << "Get instance monitoring data" << Log::Field("instanceID", instanceID.c_str())
+              << Log::Field("download", monitoringData.mMonitoringData.mDownload / cKilobyte)
+              << Log::Field("upload", monitoringData.mMonitoringData.mUpload / cKilobyte);
 
-    AOS_ERROR_THROW(ErrorEnum::eNotFound, "can't find cpu usage");
+    return ErrorEnum::eNone;
 }
 
-double Monitoring::GetInstanceCPUUsage(const std::string& instanceID)
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+double Monitoring::GetInstanceCPUUsage(CPUUsage& cpuUsage, const CgroupStats& stats) const
 {
-    auto& cpuUsage = mInstanceMonitoringCache.at(instanceID).mCPUUsage;
-    auto  cpuUSec  = GetInstanceCPUUSec(instanceID);
+    const auto cpuUSec = stats.mCPUUsageUSec;
 
     if (cpuUsage.mTotal > cpuUSec) {
         cpuUsage.mTotal = 0;
     }
 
-    const auto now    = Time::Now();
-    const auto delta  = static_cast<double>(now.Sub(cpuUsage.mTimestamp).Microseconds());
+    const auto delta  = static_cast<double>(stats.mTimestamp.Sub(cpuUsage.mTimestamp).Microseconds());
     double     result = 0.0;
 
     if (delta > 0 && mCPUCount > 0) {
@@ -165,29 +194,11 @@ double Monitoring::GetInstanceCPUUsage(const std::string& instanceID)
     }
 
     cpuUsage.mTotal     = cpuUSec;
-    cpuUsage.mTimestamp = now;
+    cpuUsage.mTimestamp = stats.mTimestamp;
 
     return result;
 }
 
-size_t Monitoring::GetInstanceRAMUsage(const std::string& instanceID)
-{
-    const auto memUsageFile = common::utils::JoinPath(cCgroupFSRoot, cCgroupsPath, instanceID, cMemUsageFile);
-
-    std::ifstream file(memUsageFile);
-    if (!file.is_open()) {
-        AOS_ERROR_THROW(ErrorEnum::eNotFound, "can't find memory usage file");
-    }
-
-    std::string line;
-
-    if (!getline(file, line)) {
-        AOS_ERROR_THROW(ErrorEnum::eFailed, "can't read memory usage file");
-    }
-
-    return std::stoull(line);
-}
-
 size_t Monitoring::GetInstanceDiskUsage(const std::string& path, uid_t uid)
 {
     auto [mountPoint, err] = common::utils::GetMountPoint(path);
@@ -10,6 +10,7 @@
 #include <mutex>
 #include <unordered_map>
 
+#include "cgroupstats.hpp"
 #include "itf/monitoring.hpp"
 
 namespace aos::sm::launcher {
@@ -64,8 +65,6 @@ public:
 
 private:
     static constexpr auto cCgroupFSRoot                  = "/sys/fs/cgroup";
-    static constexpr auto cCpuUsageFile                  = "cpu.stat";
-    static constexpr auto cMemUsageFile                  = "memory.current";
     static constexpr auto cExpectedQuotaCommandExitCodes = {0, 1};
 
     struct CPUUsage {
@@ -78,16 +77,16 @@ private:
         CPUUsage                   mCPUUsage;
         std::vector<PartitionInfo> mPartInfos;
         uid_t                      mUID {0};
+        uint64_t                   mGeneration {};
     };
 
-    double GetInstanceCPUUsage(const std::string& instanceID);
-    size_t GetInstanceCPUUSec(const std::string& instanceID);
-    size_t GetInstanceRAMUsage(const std::string& instanceID);
+    double GetInstanceCPUUsage(CPUUsage& cpuUsage, const CgroupStats& stats) const;
     size_t GetInstanceDiskUsage(const std::string& path, uid_t uid);
 
     NodeInfo                                        mNodeInfo;
     networkmanager::InstanceTrafficProviderItf*     mTrafficProvider {};
     size_t                                          mCPUCount;
+    CgroupStatsCollector                            mCgroupStats;
     mutable std::mutex                              mMutex;
     std::unordered_map<std::string, MonitoringData> mInstanceMonitoringCache;
 };
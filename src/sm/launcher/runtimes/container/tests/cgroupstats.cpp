@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tests/utils/log.hpp>
+
+#include <sm/launcher/runtimes/container/cgroupstats.hpp>
+
+using namespace testing;
+
+namespace aos::sm::launcher {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cTestDirRoot = "/tmp/test_dir/cgroupstats";
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+void CreateFile(const fs::path& filePath, const std::string& payload)
+{
+    std::ofstream file(filePath);
+
+    file << payload;
+    file.close();
+}
+
+void CreateCgroup(const std::string& name, uint64_t cpuUsage, uint64_t memory)
+{
+    const auto path = fs::path(cTestDirRoot) / name;
+
+    fs::create_directories(path);
+
+    CreateFile(path / "cpu.stat", "usage_usec " + std::to_string(cpuUsage) + "\nuser_usec 1\nsystem_usec 2\n");
+    CreateFile(path / "memory.current", std::to_string(memory) + "\n");
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class CgroupStatsTest : public Test {
+protected:
+    static void SetUpTestSuite() { tests::utils::InitLog(); }
+
+    void SetUp() override { fs::remove_all(cTestDirRoot); }
+
+    void TearDown() override { fs::remove_all(cTestDirRoot); }
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(CgroupStatsTest, CollectStats)
+{
+    CreateCgroup("instance0", 1234, 4096);
+    CreateFile(fs::path(cTestDirRoot) / "instance0" / "io.pressure",
+        "some avg10=1.25 avg60=0.00 avg300=0.00 total=77\nfull avg10=0.50 avg60=0.00 avg300=0.00 total=5\n");
+    CreateFile(fs::path(cTestDirRoot) / "instance0" / "io.stat",
+        "8:0 rbytes=10 wbytes=20 rios=1 wios=2 dbytes=0 dios=0\n"
+        "8:16 rbytes=5 wbytes=1 rios=1 wios=1 dbytes=0 dios=0\n");
+
+    CgroupStatsCollector collector;
+
+    ASSERT_TRUE(collector.Init(cTestDirRoot).IsNone());
+    ASSERT_TRUE(collector.AddCgroup("instance0").IsNone());
+
+    auto [snapshot, err] = collector.GetSnapshot(1);
+    ASSERT_TRUE(err.IsNone()) << err.Message();
+
+    EXPECT_EQ(snapshot->mGeneration, 1);
+    ASSERT_EQ(snapshot->mStats.count("instance0"), 1);
+
+    const auto& stats = snapshot->mStats.at("instance0");
+
+    EXPECT_EQ(stats.mCPUUsageUSec, 1234);
+    EXPECT_EQ(stats.mMemoryCurrent, 4096);
+    EXPECT_EQ(stats.mIOReadBytes, 15);
+    EXPECT_EQ(stats.mIOWriteBytes, 21);
+    EXPECT_DOUBLE_EQ(stats.mIOPressure.mSomeAvg10, 1.25);
+    EXPECT_EQ(stats.mIOPressure.mSomeTotal, 77);
+    EXPECT_DOUBLE_EQ(stats.mIOPressure.mFullAvg10, 0.5);
+    EXPECT_EQ(stats.mIOPressure.mFullTotal, 5);
+    EXPECT_EQ(stats.mCPUPressure.mSomeTotal, 0);
+}
+
+TEST_F(CgroupStatsTest, CollectOnlyStaleSnapshot)
+{
+    CreateCgroup("instance0", 100, 1024);
+
+    CgroupStatsCollector collector;
+
+    ASSERT_TRUE(collector.Init(cTestDirRoot).IsNone());
+    ASSERT_TRUE(collector.AddCgroup("instance0").IsNone());
+
+    auto snapshot = collector.GetSnapshot(1).mValue;
+    ASSERT_NE(snapshot, nullptr);
+
+    CreateFile(fs::path(cTestDirRoot) / "instance0" / "memory.current", "2048\n");
+
+    // Current snapshot is returned as is.
+    EXPECT_EQ(collector.GetSnapshot(1).mValue, snapshot);
+    EXPECT_EQ(snapshot->mStats.at("instance0").mMemoryCurrent, 1024);
+
+    snapshot = collector.GetSnapshot(2).mValue;
+    ASSERT_NE(snapshot, nullptr);
+
+    EXPECT_EQ(snapshot->mGeneration, 2);
+    EXPECT_EQ(snapshot->mStats.at("instance0").mMemoryCurrent, 2048);
+}
+
+TEST_F(CgroupStatsTest, CollectInParallel)
+{
+    constexpr auto cNumCgroups = 10;
+
+    CgroupStatsCollector collector;
+
+    ASSERT_TRUE(collector.Init(cTestDirRoot, 3).IsNone());
+
+    for (auto i = 0; i < cNumCgroups; i++) {
+        CreateCgroup("instance" + std::to_string(i), i, i * 1024);
+
+        ASSERT_TRUE(collector.AddCgroup("instance" + std::to_string(i)).IsNone());
+    }
+
+    ASSERT_TRUE(collector.Collect().IsNone());
+
+    auto snapshot = collector.GetSnapshot();
+
+    ASSERT_EQ(snapshot->mStats.size(), cNumCgroups);
+
+    for (auto i = 0; i < cNumCgroups; i++) {
+        const auto& stats = snapshot->mStats.at("instance" + std::to_string(i));
+
+        EXPECT_EQ(stats.mCPUUsageUSec, i);
+        EXPECT_EQ(stats.mMemoryCurrent, i * 1024);
+    }
+}
+
+TEST_F(CgroupStatsTest, MissingAndRemovedCgroups)
+{
+    CgroupStatsCollector collector;
+
+    ASSERT_TRUE(collector.Init(cTestDirRoot).IsNone());
+    ASSERT_TRUE(collector.AddCgroup("instance0").IsNone());
+    ASSERT_TRUE(collector.AddCgroup("instance1").IsNone());
+
+    CreateCgroup("instance0", 100, 1024);
+
+    ASSERT_TRUE(collector.Collect().IsNone());
+    EXPECT_EQ(collector.GetSnapshot()->mStats.size(), 1);
+
+    // Cgroup is opened once it is created.
+    CreateCgroup("instance1", 100, 1024);
+
+    ASSERT_TRUE(collector.Collect().IsNone());
+    EXPECT_EQ(collector.GetSnapshot()->mStats.size(), 2);
+
+    ASSERT_TRUE(collector.RemoveCgroup("instance0").IsNone());
+    EXPECT_TRUE(collector.RemoveCgroup("instance0").Is(ErrorEnum::eNotFound));
+
+    ASSERT_TRUE(collector.Collect().IsNone());
+
+    auto snapshot = collector.GetSnapshot();
+
+    EXPECT_EQ(snapshot->mStats.size(), 1);
+    EXPECT_EQ(snapshot->mStats.count("instance1"), 1);
+}
+
+} // namespace aos::sm::launcher
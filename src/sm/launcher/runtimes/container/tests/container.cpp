@@ -415,6 +415,70 @@ TEST_F(ContainerRuntimeTest, StartInstance)
     EXPECT_TRUE(err.Is(ErrorEnum::eAlreadyExist)) << "Unexpected error: " << tests::utils::ErrorToStr(err);
 }
 
+TEST_F(ContainerRuntimeTest, RestartInstanceReusesConfigs)
+{
+    InstanceInfo instance;
+
+    instance.mItemID         = "item0";
+    instance.mSubjectID      = "subject0";
+    instance.mInstance       = 0;
+    instance.mManifestDigest = "sha256:manifest";
+
+    auto instanceID = CreateInstanceID(static_cast<const InstanceIdent&>(instance));
+    auto status     = std::make_unique<InstanceStatus>();
+
+    EXPECT_CALL(mOCISpecMock, LoadImageManifest(_, _)).WillOnce(Invoke([](const String&, oci::ImageManifest& manifest) {
+        manifest.mItemConfig.EmplaceValue();
+
+        return ErrorEnum::eNone;
+    }));
+    EXPECT_CALL(mOCISpecMock, LoadImageConfig(_, _)).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mOCISpecMock, LoadItemConfig(_, _)).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mOCISpecMock, SaveRuntimeConfig(_, _)).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(*mRuntime.mRunner, StartInstance(instanceID, _))
+        .WillOnce(Return(RunStatus {"", InstanceStateEnum::eFailed, ErrorEnum::eFailed}))
+        .WillOnce(Return(RunStatus {"", InstanceStateEnum::eActive, ErrorEnum::eNone}));
+
+    EXPECT_FALSE(mRuntime.StartInstance(instance, *status).IsNone());
+
+    auto err = mRuntime.StartInstance(instance, *status);
+    ASSERT_TRUE(err.IsNone()) << "Failed to start instance: " << tests::utils::ErrorToStr(err);
+
+    EXPECT_EQ(status->mState, InstanceStateEnum::eActive);
+}
+
+TEST_F(ContainerRuntimeTest, RestartInstanceReloadsChangedConfigs)
+{
+    InstanceInfo instance;
+
+    instance.mItemID         = "item0";
+    instance.mSubjectID      = "subject0";
+    instance.mInstance       = 0;
+    instance.mManifestDigest = "sha256:manifest0";
+
+    auto instanceID = CreateInstanceID(static_cast<const InstanceIdent&>(instance));
+    auto status     = std::make_unique<InstanceStatus>();
+
+    EXPECT_CALL(mItemInfoProviderMock, GetBlobPath(_, _)).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mItemInfoProviderMock, GetBlobPath(String("sha256:manifest0"), _)).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mItemInfoProviderMock, GetBlobPath(String("sha256:manifest1"), _)).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mOCISpecMock, LoadImageManifest(_, _)).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mOCISpecMock, LoadImageConfig(_, _)).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(*mRuntime.mRunner, StartInstance(instanceID, _))
+        .WillOnce(Return(RunStatus {"", InstanceStateEnum::eFailed, ErrorEnum::eFailed}))
+        .WillOnce(Return(RunStatus {"", InstanceStateEnum::eActive, ErrorEnum::eNone}));
+
+    EXPECT_FALSE(mRuntime.StartInstance(instance, *status).IsNone());
+
+    instance.mManifestDigest = "sha256:manifest1";
+
+    auto err = mRuntime.StartInstance(instance, *status);
+    ASSERT_TRUE(err.IsNone()) << "Failed to start instance: " << tests::utils::ErrorToStr(err);
+
+    EXPECT_EQ(status->mState, InstanceStateEnum::eActive);
+    EXPECT_EQ(status->mManifestDigest, "sha256:manifest1");
+}
+
 TEST_F(ContainerRuntimeTest, StopInstance)
 {
     InstanceInfo instance;
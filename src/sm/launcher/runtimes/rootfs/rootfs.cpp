@@ -14,6 +14,7 @@
 #include <core/common/tools/logger.hpp>
 
 #include <common/utils/exception.hpp>
+#include <common/utils/filesystem.hpp>
 #include <common/utils/json.hpp>
 #include <common/utils/utils.hpp>
 
@@ -432,11 +433,6 @@ Error RootfsRuntime::SaveInstanceInfo(const InstanceInfo& instance, const std::f
     LOG_DBG() << "Save instance info" << Log::Field("ident", static_cast<const InstanceIdent&>(instance))
               << Log::Field("path", path.c_str());
 
-    std::ofstream file(path);
-    if (!file.is_open()) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "can't store instance info"));
-    }
-
     auto json = Poco::makeShared<Poco::JSON::Object>(Poco::JSON_PRESERVE_KEY_ORDER);
 
     try {
@@ -447,12 +443,14 @@ Error RootfsRuntime::SaveInstanceInfo(const InstanceInfo& instance, const std::f
         json->set("type", instance.mType.ToString().CStr());
         json->set("version", instance.mVersion.CStr());
         json->set("preinstalled", instance.mPreinstalled);
-
-        json->stringify(file);
     } catch (const std::exception& e) {
         return AOS_ERROR_WRAP(common::utils::ToAosError(e));
     }
 
+    if (auto err = common::utils::WriteJsonToFile(json, path.string()); !err.IsNone()) {
+        return AOS_ERROR_WRAP(Error(err, "can't store instance info"));
+    }
+
     return ErrorEnum::eNone;
 }
 
@@ -527,13 +525,10 @@ Error RootfsRuntime::CopyImage(const oci::ImageManifest& manifest) const
     LOG_DBG() << "Unpack image layer" << Log::Field("digest", manifest.mLayers[0].mDigest)
               << Log::Field("path", imageArchivePath.CStr());
 
-    std::error_code ec;
-
-    std::filesystem::copy_file(imageArchivePath.CStr(), GetPath("image.squashfs").c_str(),
-        std::filesystem::copy_options::overwrite_existing, ec);
-
-    if (ec.value() != 0) {
-        return AOS_ERROR_WRAP(Error(ec.value(), ec.message().c_str()));
+    // Blobs and the staged image are never modified in place, so the image may share the blob inode.
+    if (auto err = common::utils::CopyFile(imageArchivePath.CStr(), GetPath("image.squashfs").string(), true);
+        !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
 
     return ErrorEnum::eNone;
@@ -584,13 +579,10 @@ Error RootfsRuntime::StoreAction(const ActionType& action, const std::string& da
 {
     const auto path = GetPath(action.ToString().CStr());
 
-    std::ofstream file(path);
-    if (!file.is_open()) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "can't create action file"));
+    if (auto err = common::utils::WriteFileAtomically(path.string(), data); !err.IsNone()) {
+        return AOS_ERROR_WRAP(Error(err, "can't create action file"));
     }
 
-    file << data;
-
     return ErrorEnum::eNone;
 }
 
@@ -9,6 +9,8 @@
 #include <core/common/tools/logger.hpp>
 #include <core/common/tools/memory.hpp>
 
+#include <common/utils/tracer.hpp>
+
 #include "bandwidth.hpp"
 
 namespace aos::sm::networkmanager {
@@ -43,6 +45,8 @@ Error Bandwidth::Init(common::network::TCBackendItf& tc, InterfaceFactoryItf& if
 
 Error Bandwidth::Apply(const String& ifName, const BandwidthParams& params)
 {
+    AOS_TRACE_FUNCTION("network");
+
     if (params.mIngressRate == 0 && params.mEgressRate == 0) {
         return ErrorEnum::eNone;
     }
@@ -120,6 +124,8 @@ Error Bandwidth::Apply(const String& ifName, const BandwidthParams& params)
 
 Error Bandwidth::Clear(const String& ifName)
 {
+    AOS_TRACE_FUNCTION("network");
+
     LOG_DBG() << "Clear bandwidth" << Log::Field("ifName", ifName);
 
     if (auto err = mIfMgr->DeleteLink(IFBName(ifName)); !err.IsNone() && !err.Is(ErrorEnum::eNotFound)) {
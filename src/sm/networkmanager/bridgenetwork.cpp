@@ -10,6 +10,8 @@
 #include <core/common/tools/logger.hpp>
 #include <core/common/tools/memory.hpp>
 
+#include <common/utils/tracer.hpp>
+
 #include "bridgenetwork.hpp"
 
 namespace aos::sm::networkmanager {
@@ -27,6 +29,8 @@ Error BridgeNetwork::Init(InterfaceManagerItf& netIf)
 
 Error BridgeNetwork::Attach(const String& instanceID, const BridgeParams& params, BridgeAttachResult& result)
 {
+    AOS_TRACE_FUNCTION("network");
+
     LOG_DBG() << "Attach bridge" << Log::Field("instanceID", instanceID) << Log::Field("bridge", params.mBridgeIfName);
 
     const auto hostName = VethName(instanceID, "veth");
@@ -73,6 +77,8 @@ Error BridgeNetwork::Attach(const String& instanceID, const BridgeParams& params
 
 Error BridgeNetwork::Detach(const String& instanceID, const String& bridgeIfName)
 {
+    AOS_TRACE_FUNCTION("network");
+
     LOG_DBG() << "Detach bridge" << Log::Field("instanceID", instanceID) << Log::Field("bridge", bridgeIfName);
 
     const auto hostName = VethName(instanceID, "veth");
@@ -136,7 +136,7 @@ RetWithError<DNSServerItf*> DNSName::CreateServer(const String& networkID, const
     entry.mPID    = pid;
     entry.mServer = std::make_unique<DNSServer>();
 
-    if (err = entry.mServer->Init(nidStr, storageDir, *mSpawner, pid); !err.IsNone()) {
+    if (err = entry.mServer->Init(nidStr, storageDir, *mSpawner, pid, cHostsReloadDelay); !err.IsNone()) {
         return {nullptr, err};
     }
 
@@ -66,6 +66,8 @@ private:
     static constexpr auto cDnsmasqBinary = "/usr/sbin/dnsmasq";
     static constexpr auto cPidFileName   = "pidfile";
     static constexpr auto cHostsFileName = "addnhosts";
+    // Coalesces hosts updates of instances started or stopped together into a single dnsmasq reload.
+    static constexpr Duration cHostsReloadDelay = Time::cMilliseconds * 100;
 
     struct Entry {
         Poco::Process::PID         mPID {};
@@ -11,6 +11,8 @@
 
 #include <core/common/tools/logger.hpp>
 
+#include <common/utils/filesystem.hpp>
+
 #include "dnsserver.hpp"
 
 namespace aos::sm::networkmanager {
@@ -27,18 +29,44 @@ constexpr auto cInstanceMark  = " # ";
  **********************************************************************************************************************/
 
 Error DNSServer::Init(const std::string& networkID, const std::string& storageDir,
-    aos::common::process::ProcessSpawnerItf& spawner, Poco::Process::PID pid)
+    aos::common::process::ProcessSpawnerItf& spawner, Poco::Process::PID pid, Duration reloadDelay)
 {
-    mNetworkID  = networkID;
-    mStorageDir = storageDir;
-    mSpawner    = &spawner;
-    mPID        = pid;
+    std::lock_guard lock {mMutex};
+
+    mNetworkID   = networkID;
+    mStorageDir  = storageDir;
+    mSpawner     = &spawner;
+    mPID         = pid;
+    mReloadDelay = reloadDelay;
 
     return LoadHostsFile();
 }
 
+DNSServer::~DNSServer()
+{
+    if (auto err = mReloadTimer.Stop(Timer::StopMode::WaitForCallbacks);
+        !err.IsNone() && !err.Is(ErrorEnum::eWrongState)) {
+        LOG_ERR() << "Failed to stop DNS reload timer" << Log::Field(err);
+    }
+
+    std::lock_guard lock {mMutex};
+
+    if (!mReloadPending) {
+        return;
+    }
+
+    mReloadPending = false;
+
+    if (auto err = Flush(); !err.IsNone()) {
+        LOG_ERR() << "Failed to apply pending DNS hosts" << Log::Field("networkID", mNetworkID.c_str())
+                  << Log::Field(err);
+    }
+}
+
 Error DNSServer::AddHost(const String& instanceID, const DNSAliasesParams& params)
 {
+    std::lock_guard lock {mMutex};
+
     LOG_DBG() << "Add DNS host" << Log::Field("instanceID", instanceID) << Log::Field("networkID", mNetworkID.c_str())
               << Log::Field("ip", params.mIP);
 
@@ -55,15 +83,13 @@ Error DNSServer::AddHost(const String& instanceID, const DNSAliasesParams& param
 
     mHosts[instanceID.CStr()] = std::move(record);
 
-    if (auto err = WriteHostsFile(); !err.IsNone()) {
-        return err;
-    }
-
-    return Reload();
+    return ScheduleReload();
 }
 
 Error DNSServer::RemoveHost(const String& instanceID)
 {
+    std::lock_guard lock {mMutex};
+
     LOG_DBG() << "Remove DNS host" << Log::Field("instanceID", instanceID)
               << Log::Field("networkID", mNetworkID.c_str());
 
@@ -71,11 +97,7 @@ Error DNSServer::RemoveHost(const String& instanceID)
         return ErrorEnum::eNone;
     }
 
-    if (auto err = WriteHostsFile(); !err.IsNone()) {
-        return err;
-    }
-
-    return Reload();
+    return ScheduleReload();
 }
 
 /***********************************************************************************************************************
@@ -132,30 +154,25 @@ Error DNSServer::LoadHostsFile()
 
 Error DNSServer::WriteHostsFile() const
 {
-    const auto path = mStorageDir + "/" + cHostsFileName;
-
-    std::ofstream file(path, std::ios::out | std::ios::trunc);
-    if (!file.is_open()) {
-        return Error(ErrorEnum::eRuntime, "failed to open addnhosts");
-    }
+    std::string content;
 
     for (const auto& [instanceID, record] : mHosts) {
         if (record.mNames.empty()) {
             continue;
         }
 
-        std::string line = record.mIP;
+        content += record.mIP;
 
         for (const auto& name : record.mNames) {
-            line += "\t" + name;
+            content += "\t" + name;
         }
 
-        line += cInstanceMark + instanceID + "\n";
+        content += cInstanceMark + instanceID + "\n";
+    }
 
-        file << line;
-        if (file.fail()) {
-            return Error(ErrorEnum::eRuntime, "failed to write addnhosts");
-        }
+    // dnsmasq may reread the file at any time, so replace it atomically.
+    if (auto err = common::utils::WriteFileAtomically(mStorageDir + "/" + cHostsFileName, content); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
 
     return ErrorEnum::eNone;
@@ -170,4 +187,49 @@ Error DNSServer::Reload() const
     return ErrorEnum::eNone;
 }
 
+Error DNSServer::ScheduleReload()
+{
+    if (mReloadDelay == 0) {
+        return Flush();
+    }
+
+    if (mReloadPending) {
+        return ErrorEnum::eNone;
+    }
+
+    if (auto err = mReloadTimer.Start(mReloadDelay, [this](void*) { OnReloadTimer(); }); !err.IsNone()) {
+        LOG_WRN() << "Can't schedule DNS reload, reload now" << Log::Field(err);
+
+        return Flush();
+    }
+
+    mReloadPending = true;
+
+    return ErrorEnum::eNone;
+}
+
+Error DNSServer::Flush()
+{
+    if (auto err = WriteHostsFile(); !err.IsNone()) {
+        return err;
+    }
+
+    return Reload();
+}
+
+void DNSServer::OnReloadTimer()
+{
+    std::lock_guard lock {mMutex};
+
+    if (!mReloadPending) {
+        return;
+    }
+
+    mReloadPending = false;
+
+    if (auto err = Flush(); !err.IsNone()) {
+        LOG_ERR() << "Failed to reload DNS hosts" << Log::Field("networkID", mNetworkID.c_str()) << Log::Field(err);
+    }
+}
+
 } // namespace aos::sm::networkmanager
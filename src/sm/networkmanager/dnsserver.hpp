@@ -8,12 +8,14 @@
 #define AOS_SM_NETWORKMANAGER_DNSSERVER_HPP_
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include <Poco/Process.h>
 
 #include <core/common/tools/noncopyable.hpp>
+#include <core/common/tools/timer.hpp>
 #include <core/sm/networkmanager/itf/dnsname.hpp>
 
 #include <common/process/itf/processspawner.hpp>
@@ -25,9 +27,11 @@ namespace aos::sm::networkmanager {
  *
  * One DNSServer is created per bridge/network by DNSName and corresponds to
  * one dnsmasq process. It owns the instanceID -> {IP, names} record map,
- * rewrites <storageDir>/addnhosts on every AddHost / RemoveHost, and signals
- * dnsmasq with SIGHUP via the process spawner so the new addnhosts is picked
- * up without restarting the process.
+ * rewrites <storageDir>/addnhosts atomically (temp file + rename) after
+ * AddHost / RemoveHost, and signals dnsmasq with SIGHUP via the process
+ * spawner so the new addnhosts is picked up without restarting the process.
+ * With a non-zero reload delay, changes made within the delay are coalesced
+ * into a single rewrite and SIGHUP.
  *
  * dnsmasq lifecycle (spawn/kill, pidfile reading) is owned by the DNSName
  * factory; this handle only edits the hosts file and signals the running
@@ -45,13 +49,22 @@ public:
      * @param storageDir per-network directory containing addnhosts and pidfile.
      * @param spawner process spawner used for SIGHUP.
      * @param pid dnsmasq PID.
+     * @param reloadDelay delay used to coalesce hosts changes, changes are applied immediately if zero.
      * @return Error.
      */
     Error Init(const std::string& networkID, const std::string& storageDir,
-        aos::common::process::ProcessSpawnerItf& spawner, Poco::Process::PID pid);
+        aos::common::process::ProcessSpawnerItf& spawner, Poco::Process::PID pid, Duration reloadDelay = 0);
 
     /**
-     * Adds (or replaces) the hosts entry for an instance.
+     * Destructor. Applies pending hosts changes.
+     */
+    ~DNSServer();
+
+    /**
+     * Adds (or replaces) the hosts entry for an instance. With non-zero reload
+     * delay the hosts file rewrite and SIGHUP are deferred: success is returned
+     * once the reload is scheduled and an error of the deferred reload is only
+     * logged.
      *
      * @param instanceID instance id.
      * @param params instance IP and aliases.
@@ -61,7 +74,7 @@ public:
 
     /**
      * Removes the hosts entry for an instance. Returns eNone when the
-     * instance is unknown.
+     * instance is unknown. The reload is deferred as for AddHost.
      *
      * @param instanceID instance id.
      * @return Error.
@@ -77,12 +90,19 @@ private:
     Error LoadHostsFile();
     Error WriteHostsFile() const;
     Error Reload() const;
+    Error ScheduleReload();
+    Error Flush();
+    void  OnReloadTimer();
 
     std::string                              mNetworkID;
     std::string                              mStorageDir;
     aos::common::process::ProcessSpawnerItf* mSpawner {};
     Poco::Process::PID                       mPID {};
     std::map<std::string, HostRecord>        mHosts;
+    Duration                                 mReloadDelay {};
+    bool                                     mReloadPending {};
+    std::mutex                               mMutex;
+    aos::Timer                               mReloadTimer;
 };
 
 } // namespace aos::sm::networkmanager
@@ -12,6 +12,8 @@
 
 #include <core/common/tools/logger.hpp>
 
+#include <common/utils/tracer.hpp>
+
 #include "firewall.hpp"
 
 namespace aos::sm::networkmanager {
@@ -441,6 +443,8 @@ Error Firewall::ReconcileArtifacts(const std::vector<nftables::FWListedRule>& fo
 
 Error Firewall::AddInstance(const String& instanceID, const InstanceFirewallParams& params)
 {
+    AOS_TRACE_FUNCTION("network");
+
     LOG_DBG() << "Add firewall instance" << Log::Field("instanceID", instanceID);
 
     // Without an instance IP the parent jumps lose their address match and
@@ -529,6 +533,8 @@ void Firewall::DeleteInstanceChain(
 
 Error Firewall::RemoveInstance(const String& instanceID)
 {
+    AOS_TRACE_FUNCTION("network");
+
     LOG_DBG() << "Remove firewall instance" << Log::Field("instanceID", instanceID);
 
     const auto chain = ChainName(instanceID);
@@ -602,6 +608,8 @@ Error Firewall::BeginBatch()
 
 Error Firewall::FlushBatch()
 {
+    AOS_TRACE_FUNCTION("network");
+
     LOG_DBG() << "Flush firewall batch";
 
     std::unique_ptr<nftables::FWTxnItf> txn;
@@ -720,6 +728,8 @@ Error Firewall::Revert()
 
 Error Firewall::UpdateInstance(const String& instanceID, const InstanceFirewallParams& params)
 {
+    AOS_TRACE_FUNCTION("network");
+
     LOG_DBG() << "Update firewall instance" << Log::Field("instanceID", instanceID);
 
     if (params.mIP.IsEmpty()) {
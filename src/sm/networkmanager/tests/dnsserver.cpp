@@ -7,6 +7,7 @@
 #include <csignal>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <initializer_list>
 #include <iterator>
 #include <string>
@@ -183,3 +184,30 @@ TEST_F(DNSServerTest, EachAliasResolvesBareAndFullyQualified)
 
     EXPECT_EQ(ReadHosts(), "10.0.0.5\ta1\ta1.net1\ta2\ta2.net1 # inst1\n");
 }
+
+TEST_F(DNSServerTest, ReloadDelayCoalescesChanges)
+{
+    ASSERT_TRUE(mInstance.Init(cNetworkID, mTempDir.string(), mSpawner, cFakePID, Time::cMilliseconds * 50).IsNone());
+
+    std::promise<void> reloaded;
+
+    EXPECT_CALL(mSpawner, Signal(cFakePID, SIGHUP)).WillOnce(Invoke([&reloaded](Poco::Process::PID, int) {
+        reloaded.set_value();
+
+        return ErrorEnum::eNone;
+    }));
+
+    ASSERT_TRUE(mInstance.AddHost("inst1", MakeParams("10.0.0.5", {"app1"})).IsNone());
+    ASSERT_TRUE(mInstance.AddHost("inst2", MakeParams("10.0.0.6", {"app2"})).IsNone());
+    ASSERT_TRUE(mInstance.RemoveHost("inst1").IsNone());
+
+    EXPECT_TRUE(ReadHosts().empty());
+
+    ASSERT_EQ(reloaded.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+
+    EXPECT_EQ(ReadHosts(), "10.0.0.6\tapp2\tapp2.net1 # inst2\n");
+
+    for (const auto& entry : std::filesystem::directory_iterator(mTempDir)) {
+        EXPECT_NE(entry.path().filename().string().rfind(".addnhosts.", 0), 0);
+    }
+}
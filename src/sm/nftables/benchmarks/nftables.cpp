@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <sm/nftables/nftables.hpp>
+
+namespace aos::sm::nftables {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cTable = "aos";
+constexpr auto cChain = "AOS_INSTANCE";
+
+/***********************************************************************************************************************
+ * Benchmarks
+ **********************************************************************************************************************/
+
+// Transactions are not committed, so only rule text generation is measured and no netlink access is required.
+void BM_AddRules(benchmark::State& state)
+{
+    NFTables nft;
+
+    FWRule rule;
+
+    rule.mSrcAddr = "172.17.0.2";
+    rule.mDstAddr = "172.17.0.3";
+    rule.mProto   = "tcp";
+    rule.mDstPort = 8080;
+    rule.mAction  = FWActionEnum::eAccept;
+    rule.mCounter = true;
+
+    for (auto _ : state) {
+        auto txn = nft.NewTxn();
+
+        txn->AddChain({cTable, cChain});
+
+        for (int64_t i = 0; i < state.range(0); i++) {
+            if (auto err = txn->AddRule(cTable, cChain, rule); !err.IsNone()) {
+                state.SkipWithError("can't add rule");
+
+                return;
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_AddRules)->Arg(1)->Arg(64);
+
+} // namespace
+
+} // namespace aos::sm::nftables
@@ -16,6 +16,21 @@
 
 namespace aos::sm::smclient {
 
+namespace {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+// Instances status and monitoring data are sent anew after reconnect, so queued ones are outdated.
+bool IsOutdatedOnReconnect(const smproto::SMOutgoingMessages& message)
+{
+    return message.has_node_instances_status() || message.has_update_instances_status()
+        || message.has_instant_monitoring();
+}
+
+} // namespace
+
 /***********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
@@ -70,7 +85,14 @@ Error SMClient::Start()
 
     mStopped = false;
 
+    {
+        std::lock_guard sendLock {mSendMutex};
+
+        mSendStopped = false;
+    }
+
     StartNetworkUpdateSubscription();
+    mSendThread       = std::thread(&SMClient::SendLoop, this);
     mConnectionThread = std::thread(&SMClient::ConnectionLoop, this);
 
     return ErrorEnum::eNone;
@@ -113,6 +135,24 @@ Error SMClient::Stop()
         mNetworkUpdateThread.join();
     }
 
+    {
+        std::lock_guard lock {mSendMutex};
+
+        mSendStopped = true;
+        mSendCV.notify_all();
+
+        for (auto& queue : mSendQueues) {
+            queue.clear();
+        }
+
+        mSendStats.mDropped += mSendQueueSize;
+        mSendQueueSize = 0;
+    }
+
+    if (mSendThread.joinable()) {
+        mSendThread.join();
+    }
+
     return ErrorEnum::eNone;
 }
 
@@ -135,72 +175,36 @@ void SMClient::OnCertChanged(const CertInfo& info)
 
 Error SMClient::SendAlert(const AlertVariant& alert)
 {
-    std::lock_guard lock {mMutex};
-
     LOG_DBG() << "Send alert" << Log::Field("alert", alert);
 
-    if (!mStream) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "stream not available"));
-    }
-
     smproto::SMOutgoingMessages outgoingMsg;
     common::pbconvert::ConvertToProto(alert, *outgoingMsg.mutable_alert());
 
-    if (!mStream->Write(outgoingMsg)) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "can't send alert"));
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eNormal);
 }
 
 Error SMClient::SendMonitoringData(const aos::monitoring::NodeMonitoringData& monitoringData)
 {
-    std::lock_guard lock {mMutex};
-
     LOG_INF() << "Send monitoring data";
 
-    if (!mStream) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "stream not available"));
-    }
-
     smproto::SMOutgoingMessages outgoingMsg;
     common::pbconvert::ConvertToProto(monitoringData, *outgoingMsg.mutable_instant_monitoring());
 
-    if (!mStream->Write(outgoingMsg)) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "can't send monitoring data"));
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eNormal);
 }
 
 Error SMClient::SendLog(const PushLog& log)
 {
-    std::lock_guard lock {mMutex};
-
     LOG_INF() << "Send log";
 
-    if (!mStream) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "stream not available"));
-    }
-
     smproto::SMOutgoingMessages outgoingMsg;
     common::pbconvert::ConvertToProto(log, *outgoingMsg.mutable_log());
 
-    if (!mStream->Write(outgoingMsg)) {
-        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "can't send log"));
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eLow);
 }
 
 Error SMClient::SendNodeInstancesStatuses(const Array<aos::InstanceStatus>& statuses)
 {
-    std::lock_guard lock {mMutex};
-
-    if (!mStream) {
-        return Error(ErrorEnum::eFailed, "stream not available");
-    }
-
     smproto::SMOutgoingMessages outgoingMsg;
     auto&                       nodeStatus = *outgoingMsg.mutable_node_instances_status();
 
@@ -208,21 +212,11 @@ Error SMClient::SendNodeInstancesStatuses(const Array<aos::InstanceStatus>& stat
         common::pbconvert::ConvertToProto(status, *nodeStatus.add_instances());
     }
 
-    if (!mStream->Write(outgoingMsg)) {
-        return Error(ErrorEnum::eFailed, "can't send node instances statuses");
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eHigh);
 }
 
 Error SMClient::SendUpdateInstancesStatuses(const Array<aos::InstanceStatus>& statuses)
 {
-    std::lock_guard lock {mMutex};
-
-    if (!mStream) {
-        return Error(ErrorEnum::eFailed, "stream not available");
-    }
-
     smproto::SMOutgoingMessages outgoingMsg;
     auto&                       updateStatus = *outgoingMsg.mutable_update_instances_status();
 
@@ -230,11 +224,7 @@ Error SMClient::SendUpdateInstancesStatuses(const Array<aos::InstanceStatus>& st
         common::pbconvert::ConvertToProto(status, *updateStatus.add_instances());
     }
 
-    if (!mStream->Write(outgoingMsg)) {
-        return Error(ErrorEnum::eFailed, "can't send update instances statuses");
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eHigh);
 }
 
 Error SMClient::GetBlobsInfo(const Array<StaticString<oci::cDigestLen>>& digests, Array<StaticString<cURLLen>>& urls)
@@ -305,6 +295,13 @@ bool SMClient::IsConnected() const
     return mConnectionStatus == servicemanager::v5::ConnectionEnum::CONNECTED;
 }
 
+SendQueueStats SMClient::GetSendQueueStats() const
+{
+    std::lock_guard lock {mSendMutex};
+
+    return mSendStats;
+}
+
 Error SMClient::GetNodeNetworkParams(const String& networkID, const String& nodeID, NetworkParams& result)
 {
     std::lock_guard lock {mMutex};
@@ -573,6 +570,131 @@ bool SMClient::SendNodeInstancesStatus()
     return mStream->Write(outgoingMsg);
 }
 
+Error SMClient::EnqueueMessage(smproto::SMOutgoingMessages message, SendPriority priority)
+{
+    std::unique_lock lock {mSendMutex};
+
+    auto canEnqueue = [this] { return !mSendConnected || mSendQueueSize < cMaxSendQueueSize; };
+
+    if (!mSendCV.wait_for(lock, cSendQueueTimeout, canEnqueue)) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eTimeout, "send queue is full"));
+    }
+
+    if (!mSendConnected) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "stream not available"));
+    }
+
+    mSendQueues[static_cast<size_t>(priority)].push_back(std::move(message));
+    mSendQueueSize++;
+
+    mSendCV.notify_all();
+
+    return ErrorEnum::eNone;
+}
+
+void SMClient::SetSendState(bool connected, bool ready)
+{
+    std::unique_lock lock {mSendMutex};
+
+    mSendConnected = connected;
+    mSendReady     = ready;
+
+    if (!connected) {
+        // Stream is going to be recreated: wait for the current batch, the rest is sent over the new stream.
+        mSendCV.wait(lock, [this] { return !mWriting; });
+
+        size_t dropped = 0;
+
+        for (auto& queue : mSendQueues) {
+            dropped += std::count_if(queue.begin(), queue.end(), IsOutdatedOnReconnect);
+
+            queue.erase(std::remove_if(queue.begin(), queue.end(), IsOutdatedOnReconnect), queue.end());
+        }
+
+        mSendQueueSize -= dropped;
+        mSendStats.mDropped += dropped;
+
+        if (dropped > 0 || mSendQueueSize > 0) {
+            LOG_WRN() << "Stream closed with unsent messages" << Log::Field("dropped", dropped)
+                      << Log::Field("kept", mSendQueueSize);
+        }
+    }
+
+    mSendCV.notify_all();
+}
+
+void SMClient::SendLoop()
+{
+    LOG_DBG() << "SM client send thread started";
+
+    std::unique_lock lock {mSendMutex};
+
+    while (true) {
+        mSendCV.wait(lock, [this] { return mSendStopped || (mSendReady && mSendQueueSize > 0); });
+
+        if (mSendStopped) {
+            break;
+        }
+
+        std::vector<std::pair<size_t, smproto::SMOutgoingMessages>> batch;
+
+        for (size_t priority = 0; priority < cNumSendPriorities; priority++) {
+            auto& queue = mSendQueues[priority];
+
+            while (!queue.empty() && batch.size() < cMaxSendBatchSize) {
+                batch.emplace_back(priority, std::move(queue.front()));
+                queue.pop_front();
+            }
+        }
+
+        mSendQueueSize -= batch.size();
+        mWriting = true;
+
+        mSendCV.notify_all();
+
+        lock.unlock();
+
+        size_t written = 0;
+
+        // Buffer hint lets gRPC coalesce the batch, the last write flushes it.
+        for (; written < batch.size(); written++) {
+            auto options = grpc::WriteOptions();
+
+            if (written != batch.size() - 1) {
+                options.set_buffer_hint();
+            }
+
+            if (!mStream->Write(batch[written].second, options)) {
+                break;
+            }
+        }
+
+        lock.lock();
+
+        mWriting = false;
+        mSendStats.mSent += written;
+
+        if (written != batch.size()) {
+            LOG_ERR() << "Can't send message";
+
+            mSendConnected = false;
+            mSendReady     = false;
+
+            // Messages not accepted by the closed stream are sent over the next one.
+            for (auto it = batch.rbegin(); it != batch.rend() - written; ++it) {
+                mSendQueues[it->first].push_front(std::move(it->second));
+            }
+
+            mSendQueueSize += batch.size() - written;
+            mSendStats.mRequeued += batch.size() - written;
+        }
+
+        mSendCV.notify_all();
+    }
+
+    LOG_DBG() << "SM client send thread stopped";
+}
+
 bool SMClient::RegisterSM(const std::string& url)
 {
     std::lock_guard lock {mMutex};
@@ -617,6 +739,8 @@ bool SMClient::RegisterSM(const std::string& url)
         return false;
     }
 
+    SetSendState(true, false);
+
     LOG_INF() << "Connection established";
 
     return true;
@@ -669,13 +793,7 @@ Error SMClient::ProcessGetNodeConfigStatus()
 
     common::pbconvert::ConvertToProto(status, *outgoingMsg.mutable_node_config_status());
 
-    std::lock_guard lock {mMutex};
-
-    if (!mStream->Write(outgoingMsg)) {
-        return Error(ErrorEnum::eFailed, "failed to send node config status");
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eHigh);
 }
 
 Error SMClient::ProcessCheckNodeConfig(const smproto::CheckNodeConfig& checkConfig)
@@ -703,13 +821,7 @@ Error SMClient::ProcessCheckNodeConfig(const smproto::CheckNodeConfig& checkConf
 
     common::pbconvert::ConvertToProto(status, *outgoingMsg.mutable_node_config_status());
 
-    std::lock_guard lock {mMutex};
-
-    if (!mStream->Write(outgoingMsg)) {
-        return Error(ErrorEnum::eFailed, "failed to send node config status");
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eHigh);
 }
 
 Error SMClient::ProcessSetNodeConfig(const smproto::SetNodeConfig& setConfig)
@@ -737,13 +849,7 @@ Error SMClient::ProcessSetNodeConfig(const smproto::SetNodeConfig& setConfig)
 
     common::pbconvert::ConvertToProto(status, *outgoingMsg.mutable_node_config_status());
 
-    std::lock_guard lock {mMutex};
-
-    if (!mStream->Write(outgoingMsg)) {
-        return Error(ErrorEnum::eFailed, "failed to send node config status");
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eHigh);
 }
 
 Error SMClient::ProcessUpdateInstances(const smproto::UpdateInstances& updateInstances)
@@ -829,13 +935,7 @@ Error SMClient::ProcessGetAverageMonitoring()
     smproto::SMOutgoingMessages outgoingMsg;
     common::pbconvert::ConvertToProto(*monitoringData, *outgoingMsg.mutable_average_monitoring());
 
-    std::lock_guard lock {mMutex};
-
-    if (!mStream->Write(outgoingMsg)) {
-        return Error(ErrorEnum::eFailed, "failed to send average monitoring");
-    }
-
-    return ErrorEnum::eNone;
+    return EnqueueMessage(std::move(outgoingMsg), SendPriority::eHigh);
 }
 
 Error SMClient::ProcessConnectionStatus(const smproto::ConnectionStatus& status)
@@ -875,6 +975,8 @@ void SMClient::ConnectionLoop() noexcept
             } else if (!SendNodeInstancesStatus()) {
                 LOG_ERR() << "Can't send node instances status";
             } else {
+                SetSendState(true, true);
+
                 std::vector<aos::sm::smclient::ConnectListenerItf*> listeners;
 
                 {
@@ -889,6 +991,8 @@ void SMClient::ConnectionLoop() noexcept
                 HandleIncomingMessages();
             }
 
+            SetSendState(false, false);
+
             LOG_DBG() << "SM client connection closed";
         }
 
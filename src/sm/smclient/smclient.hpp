@@ -7,7 +7,10 @@
 #ifndef AOS_SM_SMCLIENT_SMCLIENT_HPP_
 #define AOS_SM_SMCLIENT_SMCLIENT_HPP_
 
+#include <array>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -41,6 +44,15 @@ namespace smproto = servicemanager::v5;
 
 namespace aos::sm::smclient {
 
+/**
+ * SM client send queue statistics.
+ */
+struct SendQueueStats {
+    size_t mSent {};
+    size_t mRequeued {};
+    size_t mDropped {};
+};
+
 /**
  * GRPC service manager client.
  */
@@ -251,12 +263,27 @@ public:
      */
     bool IsConnected() const override;
 
+    /**
+     * Returns send queue statistics.
+     *
+     * @return SendQueueStats.
+     */
+    SendQueueStats GetSendQueueStats() const;
+
     /**
      * Destroys object instance.
      */
     ~SMClient() = default;
 
 private:
+    // Outgoing messages are written in priority order: responses and instance statuses first, logs last.
+    enum class SendPriority { eHigh, eNormal, eLow, eNumPriorities };
+
+    static constexpr auto   cNumSendPriorities = static_cast<size_t>(SendPriority::eNumPriorities);
+    static constexpr size_t cMaxSendQueueSize  = 256;
+    static constexpr size_t cMaxSendBatchSize  = 16;
+    static constexpr auto   cSendQueueTimeout  = std::chrono::seconds(5);
+
     using StubPtr        = std::unique_ptr<smproto::SMService::StubInterface>;
     using NetworkStubPtr = std::unique_ptr<smproto::NetworkService::Stub>;
     using StreamPtr
@@ -268,6 +295,10 @@ private:
     bool SendSMInfo();
     bool SendNodeInstancesStatus();
 
+    Error EnqueueMessage(smproto::SMOutgoingMessages message, SendPriority priority);
+    void  SetSendState(bool connected, bool ready);
+    void  SendLoop();
+
     bool RegisterSM(const std::string& url);
     void ConnectionLoop() noexcept;
     void HandleIncomingMessages();
@@ -309,6 +340,19 @@ private:
     std::optional<servicemanager::v5::ConnectionEnum> mConnectionStatus;
     std::condition_variable                           mStoppedCV;
 
+    // Send queue: producers only enqueue, the stream is written by the send thread. Queued messages survive reconnect
+    // except the ones superseded by the full state sent on connect.
+    std::thread                                                             mSendThread;
+    mutable std::mutex                                                      mSendMutex;
+    std::condition_variable                                                 mSendCV;
+    std::array<std::deque<smproto::SMOutgoingMessages>, cNumSendPriorities> mSendQueues;
+    size_t                                                                  mSendQueueSize {};
+    bool                                                                    mSendConnected {};
+    bool                                                                    mSendReady {};
+    bool                                                                    mSendStopped {true};
+    bool                                                                    mWriting {};
+    SendQueueStats                                                          mSendStats;
+
     std::vector<aos::cloudconnection::ConnectionListenerItf*> mConnectionListeners;
     std::vector<aos::sm::smclient::ConnectListenerItf*>       mConnectListeners;
 
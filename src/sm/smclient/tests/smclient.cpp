@@ -1623,3 +1623,190 @@ TEST_F(SMClientTest, SubscribeListener_NotifiesOnConnect)
     err = client->Stop();
     ASSERT_TRUE(err.IsNone()) << "Stop failed";
 }
+
+TEST_F(SMClientTest, SendQueuedMessages)
+{
+    constexpr auto cNumLogs = 5;
+
+    auto server = std::make_unique<SMServiceStub>(GetConfig().mCMServerURL);
+    auto client = std::make_unique<sm::smclient::SMClient>();
+
+    auto runtimes  = CreateRuntimeInfos();
+    auto resources = CreateResourceInfos();
+    auto statuses  = CreateInstanceStatuses();
+
+    EXPECT_CALL(mTLSCredentials, GetTLSClientCredentials())
+        .WillRepeatedly(Return(aos::RetWithError<std::shared_ptr<grpc::ChannelCredentials>> {
+            grpc::InsecureChannelCredentials(), aos::ErrorEnum::eNone}));
+    EXPECT_CALL(mRuntimeInfoProvider, GetRuntimesInfos(_)).WillRepeatedly(Invoke([&runtimes](Array<RuntimeInfo>& out) {
+        for (const auto& item : *runtimes) {
+            out.PushBack(item);
+        }
+        return ErrorEnum::eNone;
+    }));
+    EXPECT_CALL(mResourceInfoProvider, GetResourcesInfos(_))
+        .WillRepeatedly(Invoke([&resources](Array<ResourceInfo>& out) {
+            for (const auto& item : *resources) {
+                out.PushBack(item);
+            }
+            return ErrorEnum::eNone;
+        }));
+    EXPECT_CALL(mInstanceStatusProvider, GetInstancesStatuses(_))
+        .WillRepeatedly(Invoke([&statuses](Array<InstanceStatus>& out) {
+            for (const auto& item : *statuses) {
+                out.PushBack(item);
+            }
+            return ErrorEnum::eNone;
+        }));
+
+    std::vector<uint64_t> parts;
+    std::promise<void>    logsReceived;
+
+    EXPECT_CALL(*server, OnSMInfo(_)).Times(1);
+    EXPECT_CALL(*server, OnNodeInstancesStatus(_)).Times(1);
+    EXPECT_CALL(*server, OnUpdateInstancesStatus(_)).Times(1);
+    EXPECT_CALL(*server, OnLogData(_)).Times(cNumLogs).WillRepeatedly(Invoke([&](const smproto::LogData& logData) {
+        parts.push_back(logData.part());
+
+        if (parts.size() == cNumLogs) {
+            logsReceived.set_value();
+        }
+    }));
+
+    auto err = client->Init(GetConfig(), "test-node", mTLSCredentials, mCertProvider, mRuntimeInfoProvider,
+        mResourceInfoProvider, mNodeConfigHandler, mLauncher, mLogProvider, mMonitoring, mInstanceStatusProvider,
+        mJSONProvider, mPendingUpdateHandler, false);
+    ASSERT_TRUE(err.IsNone()) << "Init failed";
+
+    err = client->SendLog(PushLog {});
+    EXPECT_FALSE(err.IsNone()) << "SendLog should fail if client is not connected";
+
+    err = client->Start();
+    ASSERT_TRUE(err.IsNone()) << "Start failed";
+
+    server->WaitRegistered();
+    server->WaitSMInfo();
+    server->WaitNodeInstancesStatus();
+
+    for (auto i = 1; i <= cNumLogs; i++) {
+        PushLog log;
+
+        log.mCorrelationID = "log-id";
+        log.mPartsCount    = cNumLogs;
+        log.mPart          = i;
+
+        err = client->SendLog(log);
+        ASSERT_TRUE(err.IsNone()) << "SendLog failed";
+    }
+
+    err = client->SendUpdateInstancesStatuses(*statuses);
+    ASSERT_TRUE(err.IsNone()) << "SendUpdateInstancesStatuses failed";
+
+    server->WaitUpdateInstancesStatus();
+
+    ASSERT_EQ(logsReceived.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    // Logs of the same priority keep their order.
+    EXPECT_EQ(parts, std::vector<uint64_t>({1, 2, 3, 4, 5}));
+
+    err = client->Stop();
+    ASSERT_TRUE(err.IsNone()) << "Stop failed";
+
+    auto stats = client->GetSendQueueStats();
+
+    EXPECT_EQ(stats.mSent, cNumLogs + 1);
+    EXPECT_EQ(stats.mDropped, 0);
+}
+
+TEST_F(SMClientTest, QueuedMessagesSurviveReconnect)
+{
+    auto server = std::make_unique<SMServiceStub>(GetConfig().mCMServerURL);
+    auto client = std::make_unique<sm::smclient::SMClient>();
+
+    auto runtimes  = CreateRuntimeInfos();
+    auto resources = CreateResourceInfos();
+    auto statuses  = CreateInstanceStatuses();
+
+    std::promise<void> sendingSMInfo;
+    std::promise<void> serverClosed;
+    auto               serverClosedFuture = serverClosed.get_future();
+    auto               firstConnection    = true;
+
+    EXPECT_CALL(mTLSCredentials, GetTLSClientCredentials())
+        .WillRepeatedly(Return(aos::RetWithError<std::shared_ptr<grpc::ChannelCredentials>> {
+            grpc::InsecureChannelCredentials(), aos::ErrorEnum::eNone}));
+    // The first connection is held before SM info is sent, so queued messages are not written to its stream.
+    EXPECT_CALL(mRuntimeInfoProvider, GetRuntimesInfos(_)).WillRepeatedly(Invoke([&](Array<RuntimeInfo>& out) {
+        if (firstConnection) {
+            firstConnection = false;
+
+            sendingSMInfo.set_value();
+            serverClosedFuture.wait();
+        }
+
+        for (const auto& item : *runtimes) {
+            out.PushBack(item);
+        }
+        return ErrorEnum::eNone;
+    }));
+    EXPECT_CALL(mResourceInfoProvider, GetResourcesInfos(_))
+        .WillRepeatedly(Invoke([&resources](Array<ResourceInfo>& out) {
+            for (const auto& item : *resources) {
+                out.PushBack(item);
+            }
+            return ErrorEnum::eNone;
+        }));
+    EXPECT_CALL(mInstanceStatusProvider, GetInstancesStatuses(_))
+        .WillRepeatedly(Invoke([&statuses](Array<InstanceStatus>& out) {
+            for (const auto& item : *statuses) {
+                out.PushBack(item);
+            }
+            return ErrorEnum::eNone;
+        }));
+
+    auto err = client->Init(GetConfig(), "test-node", mTLSCredentials, mCertProvider, mRuntimeInfoProvider,
+        mResourceInfoProvider, mNodeConfigHandler, mLauncher, mLogProvider, mMonitoring, mInstanceStatusProvider,
+        mJSONProvider, mPendingUpdateHandler, false);
+    ASSERT_TRUE(err.IsNone()) << "Init failed";
+
+    err = client->Start();
+    ASSERT_TRUE(err.IsNone()) << "Start failed";
+
+    ASSERT_EQ(sendingSMInfo.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    PushLog log;
+
+    log.mCorrelationID = "log-id";
+    log.mPartsCount    = 1;
+    log.mPart          = 1;
+
+    err = client->SendLog(log);
+    ASSERT_TRUE(err.IsNone()) << "SendLog failed";
+
+    err = client->SendUpdateInstancesStatuses(*statuses);
+    ASSERT_TRUE(err.IsNone()) << "SendUpdateInstancesStatuses failed";
+
+    server.reset();
+    server = std::make_unique<SMServiceStub>(GetConfig().mCMServerURL);
+
+    std::promise<void> logReceived;
+
+    EXPECT_CALL(*server, OnSMInfo(_)).Times(1);
+    EXPECT_CALL(*server, OnNodeInstancesStatus(_)).Times(1);
+    EXPECT_CALL(*server, OnUpdateInstancesStatus(_)).Times(0);
+    EXPECT_CALL(*server, OnLogData(_)).WillOnce(Invoke([&](const smproto::LogData& logData) {
+        EXPECT_EQ(logData.correlation_id(), "log-id");
+
+        logReceived.set_value();
+    }));
+
+    serverClosed.set_value();
+
+    ASSERT_EQ(logReceived.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    err = client->Stop();
+    ASSERT_TRUE(err.IsNone()) << "Stop failed";
+
+    // Update instances status is superseded by the node instances status sent on connect.
+    EXPECT_EQ(client->GetSendQueueStats().mDropped, 1);
+}